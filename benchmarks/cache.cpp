@@ -0,0 +1,87 @@
+/*!
+ * @file        cache.cpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Benchmarks of the memory cache under a scan of one-hit keys.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+//! Tegra's Bench Fixtures.
+#ifdef __has_include
+# if __has_include("fixtures.hpp")
+#   include "fixtures.hpp"
+#else
+#   error "Tegra's bench fixtures was not found!"
+# endif
+#endif
+
+//! Tegra's Cache.
+#ifdef __has_include
+# if __has_include(<cache>)
+#   include <cache>
+#else
+#   error "Tegra's cache was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::Bench;
+TEGRA_USING_NAMESPACE Tegra::Cache;
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+constexpr std::size_t HotKeys       = 60;   //!Pages that readers keep coming back to.
+constexpr std::size_t CrawlerKeys   = 250;  //!Pages a crawler reads once, between two rounds of the readers.
+constexpr std::size_t Rounds        = 40;
+constexpr std::size_t ValueSize     = 900;
+
+//! A 100 KiB namespace holds about 100 values, so the hot set fits, but not together with a round of the crawler.
+MemoryCacheOptions scanOptions(bool admission)
+{
+    MemoryCacheOptions options{};
+    options.shards          = 1;
+    options.capacity        = 200 * 1024;
+    options.sweepInterval   = 0;
+    options.admission       = admission;
+    options.namespaces      = { CacheNamespace { "pages", 100 * 1024 } };
+    return options;
+}
+
+//! Reports hit_ratio, the share of the reads of hot keys after the first round that found their value.
+void BM_MemoryCacheScan(benchmark::State& state, bool admission)
+{
+    const std::string value(ValueSize, 'x');
+    u64 hits{}, reads{};
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        MemoryCache cache { scanOptions(admission) };
+        std::size_t crawled{};
+        state.ResumeTiming();
+        for(std::size_t round = 0; round < Rounds; ++round) {
+            for(std::size_t i = 0; i < HotKeys; ++i) {
+                const auto key = "pages:hot/" + TO_TEGRA_STRING(i);
+                const auto found = cache.get(key, false);
+                if(round > 0) {
+                    ++reads;
+                    if(found.has_value()) ++hits;
+                }
+                if(!found.has_value()) cache.put(key, value, 0, false, -1);
+            }
+            for(std::size_t i = 0; i < CrawlerKeys; ++i) {
+                const auto key = "pages:crawl/" + TO_TEGRA_STRING(crawled++);
+                if(!cache.get(key, false).has_value()) cache.put(key, value, 0, false, -1);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * Rounds * (HotKeys + CrawlerKeys));
+    state.counters["hit_ratio"] = reads == __tegra_zero ? 0.0 : static_cast<double>(hits) / static_cast<double>(reads);
+}
+BENCHMARK_CAPTURE(BM_MemoryCacheScan, clock, false);
+BENCHMARK_CAPTURE(BM_MemoryCacheScan, admission, true);
+
+TEGRA_NAMESPACE_END
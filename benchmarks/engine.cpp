@@ -0,0 +1,200 @@
+/*!
+ * @file        engine.cpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Benchmarks of the string helpers of the engine, the validators and the link parser.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+//! Tegra's Bench Fixtures.
+#ifdef __has_include
+# if __has_include("fixtures.hpp")
+#   include "fixtures.hpp"
+#else
+#   error "Tegra's bench fixtures was not found!"
+# endif
+#endif
+
+//! Tegra's Config.
+#ifdef __has_include
+# if __has_include(<config>)
+#   include <config>
+#else
+#   error "Tegra's config was not found!"
+# endif
+#endif
+
+//! Tegra's Regex.
+#ifdef __has_include
+# if __has_include(<self/regex>)
+#   include <self/regex>
+#else
+#   error "Tegra's regex was not found!"
+# endif
+#endif
+
+//! Tegra's LinkParser.
+#ifdef __has_include
+# if __has_include("core/linkparser.hpp")
+#   include "core/linkparser.hpp"
+#else
+#   error "Tegra's linkparser was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::Bench;
+TEGRA_USING_NAMESPACE Tegra::System;
+TEGRA_USING_NAMESPACE Tegra::Regexation;
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+/*!
+ * @brief insertContents function returns the seed statements of config/system-database.json that Manager::insertTables filters.
+ */
+std::string insertContents()
+{
+    auto config = Configuration(ConfigType::File);
+    config.init(SectionType::Database);
+    std::string contents {};
+    for(const auto& var : Configuration::GET["tables"])
+        for(const auto& array : var["insert"])
+            for(const auto& d : array["data"])
+                contents.append(d["content"].asString());
+    //! Leaves the system core in place for the other benchmarks.
+    config.init(SectionType::SystemCore);
+    return contents;
+}
+
+/*!
+ * @brief sheetWords function returns the words of a sheet in the default language.
+ */
+VectorString sheetWords(const std::string& sheet)
+{
+    VectorString words {};
+    if(auto t = translator())
+        for(const auto& d : t->data(sheet))
+            if(d.first == "en_US")
+                words.push_back(d.second.second);
+    return words;
+}
+
+void BM_EngineFullReplacer(benchmark::State& state)
+{
+    const auto content = insertContents();
+    if(content.empty()) {
+        state.SkipWithError("config/system-database.json has no insert statements!");
+        return;
+    }
+    const MapString filterContent {
+        { "{{system_name}}",        "Tegra"                 },
+        { "{{website_address}}",    "https://genyleap.com"  },
+        { "{{email}}",              "info@genyleap.com"     },
+        { "{{multilang}}",          "true"                  },
+        { "{{table_prefix}}",       "teg_"                  },
+        { "{{timezone}}",           "Asia/Tehran"           }
+    };
+    Engine engine;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(engine.fullReplacer(content, filterContent));
+    state.SetBytesProcessed(state.iterations() * content.size());
+}
+BENCHMARK(BM_EngineFullReplacer);
+
+void BM_EngineHtmlEntityDecode(benchmark::State& state)
+{
+    //! The words of the setup sheet as a template receives them, with their markup escaped.
+    std::string content {};
+    for(const auto& word : sheetWords("setup"))
+        content.append("<p class=\"setup\">" + word + " &amp; &quot;" + word + "&quot; &lt;br/&gt;</p>\n");
+    if(content.empty()) {
+        state.SkipWithError("The translations could not be parsed!");
+        return;
+    }
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Engine::htmlEntityDecode(content));
+    state.SetBytesProcessed(state.iterations() * content.size());
+}
+BENCHMARK(BM_EngineHtmlEntityDecode);
+
+void BM_EngineJoin(benchmark::State& state, const Engine::SepratorType sep, const Engine::SepratorStyle sepStyle)
+{
+    const auto words = sheetWords("setup");
+    if(words.empty()) {
+        state.SkipWithError("The translations could not be parsed!");
+        return;
+    }
+    Engine engine;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(engine.join(words, sep, sepStyle));
+    state.SetItemsProcessed(state.iterations() * words.size());
+}
+BENCHMARK_CAPTURE(BM_EngineJoin, CommaWithSpace, Engine::SepratorType::Comma, Engine::SepratorStyle::WithSpace);
+BENCHMARK_CAPTURE(BM_EngineJoin, DashMixed, Engine::SepratorType::Dash, Engine::SepratorStyle::Mixed);
+
+using Validator = bool (Regex::*)(const std::string&);
+
+void BM_RegexValid(benchmark::State& state, const Validator validator, const std::string& input)
+{
+    auto regex = Regex();
+    for(auto _ : state)
+        benchmark::DoNotOptimize((regex.*validator)(input));
+}
+BENCHMARK_CAPTURE(BM_RegexValid, Email,         &Regex::isEmailValid,           std::string("kambiz.asadzadeh@genyleap.com"));
+BENCHMARK_CAPTURE(BM_RegexValid, Url,           &Regex::isUrlValid,             std::string("https://www.genyleap.com/en-us/blog/tegra-release"));
+BENCHMARK_CAPTURE(BM_RegexValid, Ipv4,          &Regex::isIpv4Valid,            std::string("192.168.100.254"));
+BENCHMARK_CAPTURE(BM_RegexValid, Ipv6,          &Regex::isIpv6Valid,            std::string("2001:0db8:85a3:0000:0000:8a2e:0370:7334"));
+BENCHMARK_CAPTURE(BM_RegexValid, Mac,           &Regex::isMacValid,             std::string("3D:F2:C9:A6:B3:4F"));
+BENCHMARK_CAPTURE(BM_RegexValid, Domain,        &Regex::isDomainValid,          std::string("genyleap.com"));
+BENCHMARK_CAPTURE(BM_RegexValid, Http,          &Regex::isHttpValid,            std::string("http://genyleap.com"));
+BENCHMARK_CAPTURE(BM_RegexValid, Https,         &Regex::isHttpsValid,           std::string("https://genyleap.com"));
+BENCHMARK_CAPTURE(BM_RegexValid, Ftp,           &Regex::isFtpValid,             std::string("ftp://files.genyleap.com"));
+BENCHMARK_CAPTURE(BM_RegexValid, Alphanumeric,  &Regex::isAlphanumericValid,    std::string("Tegra2026"));
+BENCHMARK_CAPTURE(BM_RegexValid, Number,        &Regex::isNumberValid,          std::string("1234567890"));
+BENCHMARK_CAPTURE(BM_RegexValid, Variable,      &Regex::isVariableValid,        std::string("table_prefix"));
+BENCHMARK_CAPTURE(BM_RegexValid, HttpImageurl,  &Regex::isHttpImageurlValid,    std::string("http://genyleap.com/templates/assets/images/logo.png"));
+BENCHMARK_CAPTURE(BM_RegexValid, Username,      &Regex::isUsernameValid,        std::string("kambiz_asadzadeh"));
+BENCHMARK_CAPTURE(BM_RegexValid, IrMobile,      &Regex::isIrMobileValid,        std::string("09121234567"));
+BENCHMARK_CAPTURE(BM_RegexValid, Hex,           &Regex::isHexValid,             std::string("#1e90ff"));
+BENCHMARK_CAPTURE(BM_RegexValid, Html,          &Regex::isHtmlValid,            std::string("<a href=\"https://genyleap.com\">Genyleap</a>"));
+BENCHMARK_CAPTURE(BM_RegexValid, Base64,        &Regex::isBase64Valid,          std::string("VGVncmEgU3lzdGVtIGlzIGZyZWUgb3BlbiBzb3VyY2Uu"));
+BENCHMARK_CAPTURE(BM_RegexValid, Isbn,          &Regex::isIsbnValid,            std::string("978-3-16-148410-0"));
+
+void BM_RegexPasswordValid(benchmark::State& state, const int mode)
+{
+    auto regex = Regex();
+    const std::string input { "Tegr@System2026" };
+    for(auto _ : state)
+        benchmark::DoNotOptimize(regex.isPasswordValid(input, mode, 8));
+}
+BENCHMARK_CAPTURE(BM_RegexPasswordValid, Simple, TEGRA_REGEX_PASSWORD_MODE_0);
+BENCHMARK_CAPTURE(BM_RegexPasswordValid, Complex, TEGRA_REGEX_PASSWORD_MODE_1);
+
+void BM_RegexPersianValid(benchmark::State& state)
+{
+    auto regex = Regex();
+    const std::wstring input { L"سیستم مدیریت محتوای تگرا" };
+    for(auto _ : state)
+        benchmark::DoNotOptimize(regex.isPersianValid(input));
+}
+BENCHMARK(BM_RegexPersianValid);
+
+void BM_LinkParserParse(benchmark::State& state, const std::string& url)
+{
+    for(auto _ : state)
+    {
+        //! parse works in place and appends to the items, so every request brings its own copy and parser.
+        auto link = url;
+        LinkParser parser;
+        parser.parse(link);
+        benchmark::DoNotOptimize(parser.items());
+    }
+}
+BENCHMARK_CAPTURE(BM_LinkParserParse, Path, std::string("/fa-ir/blog/post/42"));
+BENCHMARK_CAPTURE(BM_LinkParserParse, Url, std::string("https://www.genyleap.com/en-us/blog/tegra-release/comments/7"));
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,51 @@
+/*!
+ * @file        fixtures.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Fixtures shared by the benchmarks of tegra_bench.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_BENCH_FIXTURES_HPP
+#define TEGRA_BENCH_FIXTURES_HPP
+
+//! Tegra's Core.
+#ifdef __has_include
+# if __has_include(<core>)
+#   include <core>
+#else
+#   error "Tegra's core was not found!"
+# endif
+#endif
+
+//! Tegra's Translator.
+#ifdef __has_include
+# if __has_include(<translator>)
+#   include <translator>
+#else
+#   error "Tegra's translator was not found!"
+# endif
+#endif
+
+#include <benchmark/benchmark.h>
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Bench)
+
+/*!
+ * @brief Paths of the languages enabled in config/system-config.json; the first one is the default.
+ */
+constexpr std::array<std::string_view, 2> Paths { "/en-us", "/fa-ir" };
+
+/*!
+ * @brief translator function returns a translator that has parsed the files in translations/, as Engine::initialize does.
+ * @returns nullptr when the translations could not be parsed.
+ */
+__tegra_no_discard Translation::Translator* translator();
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_BENCH_FIXTURES_HPP
@@ -0,0 +1,54 @@
+/*!
+ * @file        main.cpp
+ * @brief       This file is part of the Tegra System.
+ * @details     tegra_bench runs the microbenchmarks of the hot paths against the config and translations of the source tree.
+ *              Usage: tegra_bench [--benchmark_filter=regex] [--benchmark_format=json] [--benchmark_out=file]
+ *              Compare two runs with tools/compare.py of Google Benchmark to get the before/after numbers of a change.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+//! Tegra's Bench Fixtures.
+#ifdef __has_include
+# if __has_include("fixtures.hpp")
+#   include "fixtures.hpp"
+#else
+#   error "Tegra's bench fixtures was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::Multilangual;
+TEGRA_USING_NAMESPACE Tegra::Translation;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Bench)
+
+Translator* translator()
+{
+    static const auto instance = [] {
+        auto t = CreateScope<Translator>();
+        Language language(std::string(Paths.front()));
+        t->setFile(language.languageSupport());
+        return t->parse() ? std::move(t) : Scope<Translator>{};
+    }();
+    return instance.get();
+}
+
+TEGRA_NAMESPACE_END
+
+int main(int argc, char** argv)
+{
+    //! Config files are opened relative to the working directory, as in the server; so are the translations on Linux.
+    std::filesystem::current_path(TEGRA_BENCH_FIXTURES);
+
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
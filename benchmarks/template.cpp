@@ -0,0 +1,111 @@
+/*!
+ * @file        template.cpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Benchmarks of the meta tags and the construction of a template.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+//! Tegra's Bench Fixtures.
+#ifdef __has_include
+# if __has_include("fixtures.hpp")
+#   include "fixtures.hpp"
+#else
+#   error "Tegra's bench fixtures was not found!"
+# endif
+#endif
+
+//! Tegra's Template.
+#ifdef __has_include
+# if __has_include(<templates>)
+#   include <templates>
+#else
+#   error "Tegra's template was not found!"
+# endif
+#endif
+
+//! Tegra's View.
+#ifdef __has_include
+# if __has_include(<view>)
+#   include <view>
+#else
+#   error "Tegra's view was not found!"
+# endif
+#endif
+
+//! Tegra's SEO.
+#ifdef __has_include
+# if __has_include(<seo>)
+#   include <seo>
+#else
+#   error "Tegra's seo was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::Bench;
+TEGRA_USING_NAMESPACE Tegra::System;
+TEGRA_USING_NAMESPACE Tegra::SEO;
+TEGRA_USING_NAMESPACE Tegra::View;
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+//! The tags StaticMeta registers for the home page.
+const MapString BaseTags {
+    { "viewport",       "width=device-width, initial-scale=1"                                   },
+    { "title",          "Tegra"                                                                 },
+    { "description",    "Tegra System is free open source multi-language Content Management System." },
+    { "keywords",       "cms, c++, drogon, multi-language"                                      },
+    { "generator",      "Tegra"                                                                 },
+    { "author",         "Kambiz Asadzadeh"                                                      },
+    { "copyright",      "Copyright (c) 2026 The Genyleap. All rights reserved."                 },
+    { "language",       "english"                                                               }
+};
+
+const MapString OpenGraph {
+    { "og:site_name",       "Tegra"                                 },
+    { "og:locale",          "en_US"                                 },
+    { "og:url",             "https://www.genyleap.com/en-us/"       },
+    { "og:updated_time",    "2026-10-19T09:00:00+00:00"             }
+};
+
+const MapString StaticExtra {
+    { "charset", "utf-8" }
+};
+
+void BM_MetaTagRegisterTags(benchmark::State& state)
+{
+    for(auto _ : state)
+    {
+        MetaTag meta;
+        meta.registerTags(MetaType::Name, BaseTags);
+        meta.registerTags(MetaType::Property, OpenGraph);
+        meta.registerTags(MetaType::Extra, StaticExtra);
+        benchmark::DoNotOptimize(meta.tags());
+    }
+    state.SetItemsProcessed(state.iterations() * (BaseTags.size() + OpenGraph.size() + StaticExtra.size()));
+}
+BENCHMARK(BM_MetaTagRegisterTags);
+
+//! The template DefIndex::index builds for every page, with its StaticMeta, Language, Configuration and Engine.
+void BM_TemplateConstruction(benchmark::State& state, std::string_view path)
+{
+    ApplicationData appData;
+    {
+        appData.path    = std::string(path);
+        appData.module  = SYSTEM_VIEW_INDEX::INDEX.data();
+    }
+    for(auto _ : state)
+    {
+        Template theme(UserType::User, appData);
+        benchmark::DoNotOptimize(theme.staticMeta);
+    }
+}
+BENCHMARK_CAPTURE(BM_TemplateConstruction, en_US, Paths[0]);
+BENCHMARK_CAPTURE(BM_TemplateConstruction, fa_IR, Paths[1]);
+
+TEGRA_NAMESPACE_END
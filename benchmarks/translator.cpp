@@ -0,0 +1,103 @@
+/*!
+ * @file        translator.cpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Benchmarks of the translator, the language and the configuration.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+//! Tegra's Bench Fixtures.
+#ifdef __has_include
+# if __has_include("fixtures.hpp")
+#   include "fixtures.hpp"
+#else
+#   error "Tegra's bench fixtures was not found!"
+# endif
+#endif
+
+//! Tegra's Config.
+#ifdef __has_include
+# if __has_include(<config>)
+#   include <config>
+#else
+#   error "Tegra's config was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::Bench;
+TEGRA_USING_NAMESPACE Tegra::System;
+TEGRA_USING_NAMESPACE Tegra::Multilangual;
+TEGRA_USING_NAMESPACE Tegra::Translation;
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+//! The words DefIndex::index translates for every page.
+const std::vector<std::pair<std::string, std::string>> PageWords {
+    { "global",     "name"          },
+    { "global",     "slogan_desc"   },
+    { "sideblock",  "copyright"     },
+    { "menu",       "home"          },
+    { "menu",       "features"      },
+    { "menu",       "contactus"     },
+    { "menu",       "source"        },
+    { "setup",      "setup"         }
+};
+
+void BM_TranslatorTranslate(benchmark::State& state, std::string_view path)
+{
+    auto t = translator();
+    if(t == nullptr) {
+        state.SkipWithError("The translations could not be parsed!");
+        return;
+    }
+    const auto lang = Language(std::string(path)).getLanguageCode();
+    for(auto _ : state)
+    {
+        for(const auto& word : PageWords)
+            benchmark::DoNotOptimize(t->translate(lang, word.first, word.second));
+    }
+    state.SetItemsProcessed(state.iterations() * PageWords.size());
+}
+BENCHMARK_CAPTURE(BM_TranslatorTranslate, en_US, Paths[0]);
+BENCHMARK_CAPTURE(BM_TranslatorTranslate, fa_IR, Paths[1]);
+
+void BM_TranslatorData(benchmark::State& state, const std::string& sheet)
+{
+    auto t = translator();
+    if(t == nullptr) {
+        state.SkipWithError("The translations could not be parsed!");
+        return;
+    }
+    for(auto _ : state)
+        benchmark::DoNotOptimize(t->data(sheet));
+}
+BENCHMARK_CAPTURE(BM_TranslatorData, global, std::string("global"));    //!Sheets of DefIndex::index.
+BENCHMARK_CAPTURE(BM_TranslatorData, account, std::string("account"));
+BENCHMARK_CAPTURE(BM_TranslatorData, setup, std::string("setup"));      //!The largest sheet.
+
+void BM_ConfigurationInit(benchmark::State& state, const SectionType sectionType)
+{
+    auto config = Configuration(ConfigType::File);
+    for(auto _ : state)
+        config.init(sectionType);
+    //! Leaves the system core in place for the other benchmarks.
+    config.init(SectionType::SystemCore);
+}
+BENCHMARK_CAPTURE(BM_ConfigurationInit, SystemCore, SectionType::SystemCore);
+BENCHMARK_CAPTURE(BM_ConfigurationInit, Database, SectionType::Database);
+
+void BM_LanguageGetLanguageCode(benchmark::State& state, std::string_view path)
+{
+    Language language { std::string(path) };
+    for(auto _ : state)
+        benchmark::DoNotOptimize(language.getLanguageCode());
+}
+BENCHMARK_CAPTURE(BM_LanguageGetLanguageCode, en_US, Paths[0]);
+BENCHMARK_CAPTURE(BM_LanguageGetLanguageCode, fa_IR, Paths[1]);
+
+TEGRA_NAMESPACE_END
@@ -134,6 +134,10 @@ if (DEBUG_LOGGING)
   add_definitions(-DDEBUG_LOGGING)
 endif()
 
+set(TEGRA_LOG_MIN_LEVEL "0" CACHE STRING "Lowest log level built in (0 trace, 1 debug, 2 info, 3 warning, 4 error, 5 critical, 6 off)")
+set_property(CACHE TEGRA_LOG_MIN_LEVEL PROPERTY STRINGS 0 1 2 3 4 5 6)
+add_definitions(-DTEGRA_LOG_MIN_LEVEL=${TEGRA_LOG_MIN_LEVEL})
+
 
 option(ENABLE_STATIC_LIB_BUILD "Build Static Version" OFF)
 if (ENABLE_STATIC_LIB_BUILD)
@@ -21,3 +21,4 @@ find_package(DocTest    REQUIRED)
 find_package(Catch2     REQUIRED)
 find_package(Fmt        REQUIRED)
 find_package(Ctre       REQUIRED)
+find_package(Benchmark  REQUIRED)
@@ -0,0 +1,34 @@
+#Package Info.
+set(BENCHMARK_NAME "Benchmark")
+set(BENCHMARK_DESCRIPTION "A library to benchmark code snippets, similar to unit tests.")
+
+#Pakcage option.
+option(USE_GOOGLE_BENCHMARK ${BENCHMARK_DESCRIPTION} FALSE)
+
+#Package data repository.
+if(USE_GOOGLE_BENCHMARK)
+    set(FETCHCONTENT_QUIET off)
+    get_filename_component(benchmark_base "${CMAKE_CURRENT_SOURCE_DIR}/${THIRD_PARTY}/benchmark"
+        REALPATH BASE_DIR "${CMAKE_BINARY_DIR}")
+    set(FETCHCONTENT_BASE_DIR ${benchmark_base})
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    #A fixed tag, so numbers taken before and after a change come from the same harness.
+    FetchContent_Declare(
+        benchmark
+        GIT_REPOSITORY      https://github.com/google/benchmark.git
+        GIT_TAG v1.8.3
+        GIT_PROGRESS   TRUE
+        USES_TERMINAL_DOWNLOAD TRUE
+        )
+
+    # Check if population has already been performed
+    FetchContent_GetProperties(benchmark)
+    string(TOLOWER "benchmark" lcName)
+    if(NOT ${lcName}_POPULATED)
+        FetchContent_Populate(${lcName})
+        add_subdirectory(${${lcName}_SOURCE_DIR} ${${lcName}_BINARY_DIR} EXCLUDE_FROM_ALL)
+    endif()
+    FetchContent_MakeAvailable(benchmark)
+endif()
@@ -355,9 +355,12 @@ using JSonException = nlohmann::detail::exception;
 #include <drogon/HttpAppFramework.h>
 #include <drogon/orm/DbClient.h>
 #include <drogon/orm/Exception.h>
+#include <drogon/nosql/RedisClient.h>
 #include <trantor/utils/Date.h>
+#include <trantor/net/InetAddress.h>
 namespace Framework = drogon;
 namespace Orm = drogon::orm;
+namespace NoSql = drogon::nosql;
 using SqlResult = drogon::orm::Result;
 using SqlException = drogon::orm::DrogonDbException;
 //!jsoncpp for framework
@@ -25,4 +25,67 @@ AbstractCache::~AbstractCache()
 {
 }
 
+OptionalString AbstractCache::getOrCompute(const std::string& key, const u32 ttl, const CacheLoader& loader)
+{
+    if(auto value = get(key, false); value.has_value()) {
+        return value;
+    }
+    return coalesce(key, [&]() -> OptionalString {
+        //! The previous flight may have filled the key between the miss and the claim.
+        if(auto value = get(key, false); value.has_value()) {
+            return value;
+        }
+        auto value = loader();
+        if(value.has_value()) {
+            put(key, value.value(), ttl, false, -1);
+        }
+        return value;
+    });
+}
+
+std::optional<u32> AbstractCache::ttlOf(const std::string& key, const bool eternal)
+{
+    return std::nullopt;
+}
+
+AbstractCache::FlightPromise AbstractCache::claim(const std::string& key, FlightResult& pending)
+{
+    std::lock_guard<std::mutex> lock(m_flightMutex);
+    if(auto it = m_flights.find(key); it != m_flights.end()) {
+        pending = it->second;
+        return nullptr;
+    }
+    auto flight = std::make_shared<std::promise<OptionalString>>();
+    m_flights.emplace(key, flight->get_future().share());
+    return flight;
+}
+
+void AbstractCache::settle(const std::string& key, const FlightPromise& flight, const OptionalString& value)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_flightMutex);
+        m_flights.erase(key);
+    }
+    flight->set_value(value);
+}
+
+OptionalString AbstractCache::coalesce(const std::string& key, const CacheLoader& producer)
+{
+    FlightResult pending{};
+    auto flight = claim(key, pending);
+    if(flight == nullptr) {
+        return pending.get();
+    }
+    OptionalString value{};
+    try {
+        value = producer();
+    } catch(...) {
+        //! Waiters see a miss and the next caller tries again.
+        settle(key, flight, std::nullopt);
+        throw;
+    }
+    settle(key, flight, value);
+    return value;
+}
+
 TEGRA_NAMESPACE_END
@@ -29,6 +29,8 @@ struct CacheMembers __tegra_final
     OptionalString  storage   {}; ///< String path to the "eternal" storage files. About what "eternal cache" is, read below.
 };
 
+using CacheLoader = std::function<OptionalString()>; ///< Generator of a cache value; std::nullopt is not cached.
+
 /*!
  * Caching class constructor.
  * \brief The AbstractCache class
@@ -51,7 +53,7 @@ public:
      * \param int|null insur Cache hopelessly expired. Used to prevent the dog-pile effect. Default is twice ttl.
      * \returns boolean.
      */
-    __tegra_virtual OptionalBool put(const std::string& key, const bool value, const u32 ttl, const bool eternal, const int insur) = __tegra_zero;
+    __tegra_virtual OptionalBool put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur) = __tegra_zero;
 
     /*!
      * \brief Get data from the cache.
@@ -76,7 +78,49 @@ public:
      */
     __tegra_virtual OptionalBool obsolete(const std::string& key, const bool eternal) = __tegra_zero;
 
+    /*!
+     * \brief Get data from the cache or generate it, running the generator once for all concurrent misses of the key.
+     * Implementations that can read expired values may return them while a single refresh runs in the background;
+     * the loader must then own everything it captures.
+     * \param string key cache storage location name.
+     * \param int ttl storage time in seconds.
+     * \param loader generator of the value.
+     * \returns string.
+     */
+    __tegra_virtual OptionalString getOrCompute(const std::string& key, const u32 ttl, const CacheLoader& loader);
+
+    /*!
+     * \brief Get the time a value has left to live.
+     * \param string key cache storage location name.
+     * \param bool eternal eternal cache flag.
+     * \returns seconds, zero if the value never expires, or nothing if the value is missing or the storage does not keep it.
+     */
+    __tegra_virtual std::optional<u32> ttlOf(const std::string& key, const bool eternal);
+
+protected:
+    using FlightResult  = std::shared_future<OptionalString>;
+    using FlightPromise = std::shared_ptr<std::promise<OptionalString>>;
+
+    /*!
+     * \brief Runs the producer once for all concurrent callers of the same key; the others wait for its result.
+     */
+    OptionalString coalesce(const std::string& key, const CacheLoader& producer);
+
+    /*!
+     * \brief Claims the flight of a key.
+     * \returns promise of the new flight, or nullptr with pending set to the running one.
+     */
+    FlightPromise claim(const std::string& key, FlightResult& pending);
+
+    /*!
+     * \brief Ends a claimed flight and wakes its waiters.
+     */
+    void settle(const std::string& key, const FlightPromise& flight, const OptionalString& value);
+
 private:
+    std::mutex                                      m_flightMutex   {};
+    std::unordered_map<std::string, FlightResult>   m_flights       {};     ///< Running generators by key.
+
     TEGRA_DISABLE_COPY(AbstractCache)
 };
 
@@ -0,0 +1,551 @@
+//! Tegra's Disk Cache.
+#ifdef __has_include
+# if __has_include("disk.hpp")
+#   include "disk.hpp"
+#else
+#   error "Tegra's disk cache was not found!"
+# endif
+#endif
+
+//! Tegra's Logger.
+#ifdef __has_include
+# if __has_include(<logger>)
+#   include <logger>
+#else
+#   error "Tegra's logger was not found!"
+# endif
+#endif
+
+#if defined(PLATFORM_MAC) || defined(PLATFORM_LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#elif defined(PLATFORM_WINDOWS)
+#include <Windows.h>
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+/*!
+ * Record layout, little endian:
+ * [0]  u32 magic   [4]  u32 crc of everything after it   [8]  s64 expiresAt
+ * [16] u32 key     [20] u32 value                         [24] u32 flags   [28] u32 reserved
+ * [32] key bytes, value bytes, zero padding to 8 bytes.
+ */
+constexpr u32 RECORD_MAGIC      = 0x31434754; // TGC1
+constexpr u64 RECORD_HEADER     = 32;
+constexpr u32 FLAG_TOMBSTONE    = 0x1;
+constexpr std::string_view SEGMENT_PREFIX = "segment-";
+constexpr std::string_view SEGMENT_SUFFIX = ".tgc";
+
+//! Upper bound of the threads that scan the segments on open.
+constexpr std::size_t MAX_SCANNERS = 4;
+
+constexpr std::array<u32, 256> CRC_TABLE = []() {
+    std::array<u32, 256> table{};
+    for(u32 i = 0; i < 256; ++i) {
+        u32 c = i;
+        for(int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        table[i] = c;
+    }
+    return table;
+}();
+
+u32 crc32(const char* data, u64 size) __tegra_noexcept
+{
+    u32 crc = 0xFFFFFFFFu;
+    for(u64 i = 0; i < size; ++i) {
+        crc = CRC_TABLE[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+u64 align8(u64 size) __tegra_noexcept
+{
+    return (size + 7) & ~static_cast<u64>(7);
+}
+
+template<typename T>
+T readAt(const char* data, u64 offset) __tegra_noexcept
+{
+    T value{};
+    std::memcpy(&value, data + offset, sizeof(T));
+    return value;
+}
+
+template<typename T>
+void writeAt(char* data, u64 offset, T value) __tegra_noexcept
+{
+    std::memcpy(data + offset, &value, sizeof(T));
+}
+
+s64 wallSeconds() __tegra_noexcept
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+bool isExpired(s64 at) __tegra_noexcept
+{
+    return at != __tegra_zero && wallSeconds() >= at;
+}
+
+std::string_view recordValue(const char* data, u64 offset)
+{
+    const auto key = readAt<u32>(data, offset + 16);
+    const auto value = readAt<u32>(data, offset + 20);
+    return { data + offset + RECORD_HEADER + key, value };
+}
+
+std::string segmentName(u32 id)
+{
+    std::ostringstream stream{};
+    stream << SEGMENT_PREFIX << std::setw(8) << std::setfill('0') << id << SEGMENT_SUFFIX;
+    return stream.str();
+}
+
+bool mapFile(const std::string& path, u64 size, bool writable, s64& handle, s64& mapping, char*& data)
+{
+#if defined(PLATFORM_MAC) || defined(PLATFORM_LINUX)
+    const int fd = ::open(path.c_str(), writable ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+    if(fd < 0) return false;
+    //! A new segment is a sparse file of its full size, so appends never remap.
+    if(writable && ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        return false;
+    }
+    void* address = ::mmap(nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    if(address == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+    handle = fd;
+    data = static_cast<char*>(address);
+    return true;
+#elif defined(PLATFORM_WINDOWS)
+    HANDLE file = ::CreateFileA(path.c_str(), writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ, FILE_SHARE_READ,
+                                nullptr, writable ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) return false;
+    HANDLE map = ::CreateFileMappingA(file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+                                      static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFF), nullptr);
+    if(map == nullptr) {
+        ::CloseHandle(file);
+        return false;
+    }
+    void* address = ::MapViewOfFile(map, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+    if(address == nullptr) {
+        ::CloseHandle(map);
+        ::CloseHandle(file);
+        return false;
+    }
+    handle = reinterpret_cast<s64>(file);
+    mapping = reinterpret_cast<s64>(map);
+    data = static_cast<char*>(address);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void syncFile(char* data, u64 size, bool wait)
+{
+#if defined(PLATFORM_MAC) || defined(PLATFORM_LINUX)
+    ::msync(data, size, wait ? MS_SYNC : MS_ASYNC);
+#elif defined(PLATFORM_WINDOWS)
+    ::FlushViewOfFile(data, size);
+#endif
+}
+
+void unmapFile(char* data, u64 size, s64 handle, s64 mapping, std::optional<u64> truncate)
+{
+#if defined(PLATFORM_MAC) || defined(PLATFORM_LINUX)
+    ::munmap(data, size);
+    if(truncate.has_value()) {
+        [[maybe_unused]] const auto res = ::ftruncate(static_cast<int>(handle), static_cast<off_t>(truncate.value()));
+    }
+    ::close(static_cast<int>(handle));
+#elif defined(PLATFORM_WINDOWS)
+    ::UnmapViewOfFile(data);
+    ::CloseHandle(reinterpret_cast<HANDLE>(mapping));
+    if(truncate.has_value()) {
+        LARGE_INTEGER position{};
+        position.QuadPart = static_cast<LONGLONG>(truncate.value());
+        ::SetFilePointerEx(reinterpret_cast<HANDLE>(handle), position, nullptr, FILE_BEGIN);
+        ::SetEndOfFile(reinterpret_cast<HANDLE>(handle));
+    }
+    ::CloseHandle(reinterpret_cast<HANDLE>(handle));
+#endif
+}
+
+TEGRA_NAMESPACE_END
+
+DiskCache::DiskCache(const Abstracts::CacheMembers& members, const DiskCacheOptions& options) : m_members(members), m_options(options)
+{
+    m_options.segmentSize = std::max<u64>(m_options.segmentSize, 64 * 1024);
+    open();
+    if(m_open) {
+        compact();
+    }
+}
+
+DiskCache::~DiskCache()
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for(auto& segment : m_segments) {
+        release(*segment, segment->writable);
+    }
+    m_segments.clear();
+}
+
+bool DiskCache::isOpen() const __tegra_noexcept
+{
+    return m_open;
+}
+
+std::vector<DiskCache::ScannedRecord> DiskCache::scan(const Segment& segment) const
+{
+    std::vector<ScannedRecord> res{};
+    u64 offset{};
+    while(offset + RECORD_HEADER <= segment.capacity) {
+        const char* data = segment.data;
+        if(readAt<u32>(data, offset) != RECORD_MAGIC) break;
+        const auto key      = readAt<u32>(data, offset + 16);
+        const auto value    = readAt<u32>(data, offset + 20);
+        const auto size     = align8(RECORD_HEADER + key + value);
+        if(offset + size > segment.capacity) break;
+        //! A torn or corrupted record ends the segment; everything before it is intact.
+        if(readAt<u32>(data, offset + 4) != crc32(data + offset + 8, RECORD_HEADER - 8 + key + value)) break;
+        ScannedRecord record{};
+        record.key                  = std::string(data + offset + RECORD_HEADER, key);
+        record.location.segment     = segment.id;
+        record.location.offset      = offset;
+        record.location.size        = size;
+        record.location.expiresAt   = readAt<s64>(data, offset + 8);
+        record.tombstone            = (readAt<u32>(data, offset + 24) & FLAG_TOMBSTONE) != 0;
+        res.push_back(std::move(record));
+        offset += size;
+    }
+    return res;
+}
+
+void DiskCache::open()
+{
+    m_directory = m_members.storage.value_or("storage/cache/");
+    std::error_code error{};
+    std::filesystem::create_directories(m_directory, error);
+    if(error) {
+        eLogger::Log("Cache storage [" + m_directory.string() + "] can not be created: " + error.message(), eLogger::LoggerType::Critical);
+        return;
+    }
+    for(const auto& file : std::filesystem::directory_iterator(m_directory, error)) {
+        const auto name = file.path().filename().string();
+        if(!name.starts_with(SEGMENT_PREFIX) || !name.ends_with(SEGMENT_SUFFIX)) continue;
+        const auto size = file.file_size(error);
+        if(error || size < RECORD_HEADER) {
+            std::filesystem::remove(file.path(), error);
+            continue;
+        }
+        auto segment = CreateScope<Segment>();
+        segment->id = static_cast<u32>(std::strtoul(name.substr(SEGMENT_PREFIX.size()).c_str(), nullptr, 10));
+        segment->path = file.path().string();
+        segment->capacity = size;
+        if(!mapFile(segment->path, size, false, segment->handle, segment->mapping, segment->data)) {
+            eLogger::Log("Cache segment [" + segment->path + "] can not be mapped!", eLogger::LoggerType::Warning);
+            continue;
+        }
+        m_nextId = std::max(m_nextId, segment->id + 1);
+        m_segments.push_back(std::move(segment));
+    }
+    std::sort(m_segments.begin(), m_segments.end(), [](const auto& a, const auto& b) { return a->id < b->id; });
+
+    //! Segments are scanned by a bounded set of threads; the index is merged in segment order, so later records win.
+    std::vector<std::vector<ScannedRecord>> scans(m_segments.size());
+    {
+        std::atomic<std::size_t> next{};
+        std::vector<std::thread> scanners{};
+        const auto count = std::min(m_segments.size(), std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, MAX_SCANNERS));
+        for(std::size_t w = 0; w < count; ++w) {
+            scanners.emplace_back([this, &next, &scans]() {
+                for(auto i = next.fetch_add(1); i < m_segments.size(); i = next.fetch_add(1)) {
+                    scans[i] = scan(*m_segments[i]);
+                }
+            });
+        }
+        for(auto& scanner : scanners) {
+            scanner.join();
+        }
+    }
+    for(std::size_t i = 0; i < m_segments.size(); ++i) {
+        auto& segment = *m_segments[i];
+        for(auto& record : scans[i]) {
+            segment.used = record.location.offset + record.location.size;
+            auto it = m_index.find(record.key);
+            if(it != m_index.end()) {
+                retire(it->second);
+                m_index.erase(it);
+            }
+            if(record.tombstone || isExpired(record.location.expiresAt)) {
+                segment.dead += record.location.size;
+                continue;
+            }
+            m_index.emplace(std::move(record.key), record.location);
+        }
+    }
+    m_open = true;
+    eLogger::Log(eLogger::LoggerType::Info, "Cache storage has been opened with {} entries in {} segment(s).", m_index.size(), m_segments.size());
+}
+
+DiskCache::Segment* DiskCache::segmentOf(u32 id) const
+{
+    auto it = std::lower_bound(m_segments.begin(), m_segments.end(), id, [](const auto& s, u32 value) { return s->id < value; });
+    return it == m_segments.end() || (*it)->id != id ? nullptr : it->get();
+}
+
+void DiskCache::retire(const Location& location)
+{
+    if(auto segment = segmentOf(location.segment)) {
+        segment->dead += location.size;
+    }
+}
+
+void DiskCache::release(Segment& segment, bool truncate)
+{
+    if(segment.data == nullptr) {
+        return;
+    }
+    if(segment.writable) {
+        syncFile(segment.data, segment.used, true);
+    }
+    //! The unused tail of the active segment is given back; the file is reopened read-only next time.
+    unmapFile(segment.data, segment.capacity, segment.handle, segment.mapping,
+              truncate ? std::optional<u64>(std::max(segment.used, RECORD_HEADER)) : std::nullopt);
+    segment.data = nullptr;
+}
+
+DiskCache::Segment* DiskCache::writer(u64 size)
+{
+    if(!m_segments.empty()) {
+        auto& last = *m_segments.back();
+        if(last.writable && last.used + size <= last.capacity) {
+            return &last;
+        }
+        if(last.writable) {
+            syncFile(last.data, last.used, false);
+        }
+    }
+    auto segment = CreateScope<Segment>();
+    segment->id         = m_nextId++;
+    segment->path       = (m_directory / segmentName(segment->id)).string();
+    segment->capacity   = m_options.segmentSize;
+    segment->writable   = true;
+    if(!mapFile(segment->path, segment->capacity, true, segment->handle, segment->mapping, segment->data)) {
+        eLogger::Log("Cache segment [" + segment->path + "] can not be created!", eLogger::LoggerType::Critical);
+        return nullptr;
+    }
+    m_segments.push_back(std::move(segment));
+    return m_segments.back().get();
+}
+
+bool DiskCache::append(const std::string& key, std::string_view value, s64 expiresAt, bool tombstone, Location& location)
+{
+    const auto size = align8(RECORD_HEADER + key.size() + value.size());
+    if(!m_open || size > m_options.segmentSize) {
+        return false;
+    }
+    auto segment = writer(size);
+    if(segment == nullptr) {
+        return false;
+    }
+    char* data = segment->data + segment->used;
+    writeAt<u32>(data, 0, RECORD_MAGIC);
+    writeAt<s64>(data, 8, expiresAt);
+    writeAt<u32>(data, 16, static_cast<u32>(key.size()));
+    writeAt<u32>(data, 20, static_cast<u32>(value.size()));
+    writeAt<u32>(data, 24, tombstone ? FLAG_TOMBSTONE : 0);
+    writeAt<u32>(data, 28, 0);
+    std::memcpy(data + RECORD_HEADER, key.data(), key.size());
+    std::memcpy(data + RECORD_HEADER + key.size(), value.data(), value.size());
+    std::memset(data + RECORD_HEADER + key.size() + value.size(), 0, size - (RECORD_HEADER + key.size() + value.size()));
+    writeAt<u32>(data, 4, crc32(data + 8, RECORD_HEADER - 8 + key.size() + value.size()));
+    if(m_options.syncOnWrite) {
+        syncFile(segment->data, segment->used + size, true);
+    }
+    location = { segment->id, segment->used, size, expiresAt, false };
+    segment->used += size;
+    if(tombstone) {
+        segment->dead += size;
+    }
+    return true;
+}
+
+OptionalBool DiskCache::put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur)
+{
+    std::size_t compactable{};
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        Location location{};
+        if(!append(key, value, ttl == __tegra_zero ? __tegra_zero : wallSeconds() + ttl, false, location)) {
+            return false;
+        }
+        auto it = m_index.find(key);
+        if(it != m_index.end()) {
+            retire(it->second);
+            it->second = location;
+        } else {
+            m_index.emplace(key, location);
+        }
+        for(std::size_t i = 0; i + 1 < m_segments.size(); ++i) {
+            const auto& s = *m_segments[i];
+            if(s.used == __tegra_zero || static_cast<double>(s.dead) / static_cast<double>(s.used) >= m_options.compactRatio) ++compactable;
+        }
+    }
+    if(compactable != __tegra_zero) {
+        compact();
+    }
+    return true;
+}
+
+CacheBuffer DiskCache::find(const std::string& key) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if(it == m_index.end() || it->second.obsolete || isExpired(it->second.expiresAt)) {
+        return nullptr;
+    }
+    auto segment = segmentOf(it->second.segment);
+    if(segment == nullptr || segment->data == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<const std::string>(recordValue(segment->data, it->second.offset));
+}
+
+OptionalString DiskCache::get(const std::string& key, const bool eternal)
+{
+    auto value = find(key);
+    if(value == nullptr) {
+        return std::nullopt;
+    }
+    return *value;
+}
+
+OptionalBool DiskCache::deleteCache(const std::string& key, const bool eternal)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if(it == m_index.end()) {
+        return false;
+    }
+    //! Without a tombstone the record would come back on the next restart.
+    Location tombstone{};
+    if(!append(key, {}, __tegra_zero, true, tombstone)) {
+        return false;
+    }
+    retire(it->second);
+    m_index.erase(it);
+    return true;
+}
+
+std::optional<u32> DiskCache::ttlOf(const std::string& key, const bool eternal)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if(it == m_index.end() || it->second.obsolete || isExpired(it->second.expiresAt)) {
+        return std::nullopt;
+    }
+    if(it->second.expiresAt == __tegra_zero) {
+        return __tegra_zero;
+    }
+    return static_cast<u32>(std::max<s64>(1, it->second.expiresAt - wallSeconds()));
+}
+
+OptionalBool DiskCache::obsolete(const std::string& key, const bool eternal)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if(it == m_index.end()) {
+        return false;
+    }
+    it->second.obsolete = true;
+    return true;
+}
+
+std::size_t DiskCache::compact()
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    std::erase_if(m_index, [this](const auto& e) {
+        if(!isExpired(e.second.expiresAt)) return false;
+        retire(e.second);
+        return true;
+    });
+    std::size_t res{};
+    for(std::size_t i = 0; i < m_segments.size(); ++i) {
+        auto& segment = *m_segments[i];
+        const bool active = i + 1 == m_segments.size() && segment.writable;
+        //! A segment without records has nothing to carry over and is removed as it is.
+        if(active || (segment.used != __tegra_zero && static_cast<double>(segment.dead) / static_cast<double>(segment.used) < m_options.compactRatio)) {
+            continue;
+        }
+        const auto records = segment.used == __tegra_zero ? std::vector<ScannedRecord>{} : scan(segment);
+        //! A tombstone must outlive every older segment that still holds a record of its key; once none does, it is dropped.
+        std::unordered_set<std::string> shadowed{};
+        for(const auto& record : records) {
+            if(i > 0 && record.tombstone && !m_index.contains(record.key)) shadowed.insert(record.key);
+        }
+        if(!shadowed.empty()) {
+            std::unordered_set<std::string> held{};
+            for(std::size_t older = 0; older < i && held.size() < shadowed.size(); ++older) {
+                //! A segment that can not be read may hold any key.
+                if(m_segments[older]->data == nullptr) {
+                    held = shadowed;
+                    break;
+                }
+                for(const auto& record : scan(*m_segments[older])) {
+                    if(!record.tombstone && shadowed.contains(record.key)) held.insert(record.key);
+                }
+            }
+            shadowed = std::move(held);
+        }
+        for(const auto& record : records) {
+            Location location{};
+            if(record.tombstone) {
+                if(shadowed.contains(record.key) && !append(record.key, {}, __tegra_zero, true, location)) return res;
+                continue;
+            }
+            auto it = m_index.find(record.key);
+            if(it == m_index.end() || it->second.segment != segment.id || it->second.offset != record.location.offset) {
+                continue;
+            }
+            if(!append(record.key, recordValue(segment.data, record.location.offset), record.location.expiresAt, false, location)) {
+                return res;
+            }
+            location.obsolete = it->second.obsolete;
+            it->second = location;
+        }
+        release(segment, false);
+        std::error_code error{};
+        std::filesystem::remove(segment.path, error);
+        m_segments.erase(m_segments.begin() + static_cast<std::ptrdiff_t>(i));
+        --i;
+        ++res;
+    }
+    return res;
+}
+
+void DiskCache::flush()
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    if(!m_segments.empty() && m_segments.back()->writable) {
+        syncFile(m_segments.back()->data, m_segments.back()->used, true);
+    }
+}
+
+std::size_t DiskCache::size() const
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_index.size();
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,160 @@
+/*!
+ * @file        disk.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Persistent cache tier backed by memory-mapped segment files.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_CACHE_DISK_HPP
+#define TEGRA_CACHE_DISK_HPP
+
+//! Tegra's Memory Cache.
+#ifdef __has_include
+# if __has_include("memory.hpp")
+#   include "memory.hpp"
+#else
+#   error "Tegra's memory cache was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+/*!
+ * @brief The DiskCacheOptions struct holds the limits of a disk cache.
+ */
+struct DiskCacheOptions final
+{
+    u64     segmentSize     {64 * 1024 * 1024};     ///< Size of a segment file; a record can not be larger.
+    double  compactRatio    {0.5};                  ///< Share of dead bytes that makes a sealed segment worth compacting.
+    bool    syncOnWrite     {false};                ///< Flush the mapping after every write instead of on rotation and close.
+};
+
+/*!
+ * @brief The DiskCache class is the "eternal" tier: an append-only log of records in memory-mapped segment files with an in-memory index.
+ * Every record carries a CRC, so a torn tail after a crash ends the scan of its segment instead of returning garbage.
+ * Deletes append a tombstone; overwritten, deleted and expired records are dead bytes that compaction copies away.
+ * On open, the segments are scanned by a few threads and the index is rebuilt, later segments winning;
+ * segments left without live records are reclaimed right away.
+ * The time to live is stored as wall clock time, so it keeps counting across restarts.
+ */
+class __tegra_export DiskCache final : public Abstracts::AbstractCache
+{
+public:
+    /*!
+     * @brief Opens the storage and rebuilds the index.
+     * @param members holds the storage path.
+     * @param options are the limits.
+     */
+    explicit DiskCache(const Abstracts::CacheMembers& members, const DiskCacheOptions& options = {});
+    ~DiskCache();
+
+    /*!
+     * @brief put function appends a record; the eternal flag is implied by the tier.
+     * @returns false if the record is larger than a segment or the storage can not be written.
+     */
+    OptionalBool put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur) __tegra_override;
+
+    /*!
+     * @brief get function returns a copy of a live value.
+     */
+    OptionalString get(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief deleteCache function appends a tombstone for the key.
+     */
+    OptionalBool deleteCache(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief obsolete function hides the value until it is written again; the mark is not persisted.
+     */
+    OptionalBool obsolete(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief ttlOf function returns the seconds a live value has left, zero if it never expires.
+     */
+    std::optional<u32> ttlOf(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief find function returns a live value as a shared buffer.
+     */
+    __tegra_no_discard CacheBuffer find(const std::string& key) const;
+
+    /*!
+     * @brief compact function rewrites the sealed segments whose dead share reached compactRatio and removes empty ones.
+     * @returns number of compacted segments.
+     */
+    std::size_t compact();
+
+    /*!
+     * @brief flush function writes the active segment to disk.
+     */
+    void flush();
+
+    /*!
+     * @brief size function returns the number of live keys.
+     */
+    __tegra_no_discard std::size_t size() const;
+
+    /*!
+     * @brief isOpen checks if the storage could be opened.
+     */
+    __tegra_no_discard bool isOpen() const __tegra_noexcept;
+
+private:
+    struct Segment final
+    {
+        u32             id          {};
+        std::string     path        {};
+        char*           data        {nullptr};  ///< Mapping of the file.
+        u64             capacity    {};         ///< Size of the mapping.
+        u64             used        {};         ///< Bytes of valid records.
+        u64             dead        {};         ///< Bytes of records that are no longer live.
+        bool            writable    {false};
+        s64             handle      {-1};       ///< Native file handle.
+        s64             mapping     {-1};       ///< Native mapping handle (Windows only).
+    };
+
+    struct Location final
+    {
+        u32     segment     {};
+        u64     offset      {};     ///< Offset of the record.
+        u64     size        {};     ///< Size of the record, padding included.
+        s64     expiresAt   {};     ///< Wall clock seconds, zero never expires.
+        bool    obsolete    {false};
+    };
+
+    struct ScannedRecord final
+    {
+        std::string key         {};
+        Location    location    {};
+        bool        tombstone   {false};
+    };
+
+    void open();
+    __tegra_no_discard std::vector<ScannedRecord> scan(const Segment& segment) const;
+    __tegra_no_discard Segment* segmentOf(u32 id) const;
+    __tegra_no_discard Segment* writer(u64 size);
+    bool append(const std::string& key, std::string_view value, s64 expiresAt, bool tombstone, Location& location);
+    void release(Segment& segment, bool truncate);
+    void retire(const Location& location);
+
+    Abstracts::CacheMembers                 m_members   {};
+    DiskCacheOptions                        m_options   {};
+    std::filesystem::path                   m_directory {};
+    mutable std::shared_mutex               m_mutex     {};
+    std::unordered_map<std::string, Location> m_index   {};
+    std::vector<Scope<Segment>>             m_segments  {};     ///< Ordered by id, the last one may be writable.
+    u32                                     m_nextId    {1};
+    bool                                    m_open      {false};
+
+    TEGRA_DISABLE_COPY(DiskCache)
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_CACHE_DISK_HPP
@@ -0,0 +1,149 @@
+//! Tegra's Cache Manager.
+#ifdef __has_include
+# if __has_include("manager.hpp")
+#   include "manager.hpp"
+#else
+#   error "Tegra's cache manager was not found!"
+# endif
+#endif
+
+//! Tegra's Disk Cache.
+#ifdef __has_include
+# if __has_include("disk.hpp")
+#   include "disk.hpp"
+#else
+#   error "Tegra's disk cache was not found!"
+# endif
+#endif
+
+//! Tegra's Redis Cache.
+#ifdef __has_include
+# if __has_include("redis.hpp")
+#   include "redis.hpp"
+#else
+#   error "Tegra's redis cache was not found!"
+# endif
+#endif
+
+//! Tegra's Table Cache.
+#ifdef __has_include
+# if __has_include("table.hpp")
+#   include "table.hpp"
+#else
+#   error "Tegra's table cache was not found!"
+# endif
+#endif
+
+//! Tegra's Cache Tags.
+#ifdef __has_include
+# if __has_include("tags.hpp")
+#   include "tags.hpp"
+#else
+#   error "Tegra's cache tags was not found!"
+# endif
+#endif
+
+//! Tegra's Logger.
+#ifdef __has_include
+# if __has_include(<logger>)
+#   include <logger>
+#else
+#   error "Tegra's logger was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+void CacheManager::configure(const JSonData& section)
+{
+    if(section.isNull()) {
+        return;
+    }
+    constexpr u64 MEGABYTE = 1024 * 1024;
+    const auto tags = section["tags"];
+    if(!tags.isNull()) {
+        VectorString generational{};
+        for(const auto& prefix : tags["generational"]) {
+            generational.push_back(prefix.asString());
+        }
+        TagIndex::configure(generational);
+        if(tags.isMember("max_keys"))     TagIndex::maxKeys       = tags["max_keys"].asUInt64();
+        if(tags.isMember("max_reloads"))  TagIndex::maxReloads    = tags["max_reloads"].asUInt();
+        if(tags.isMember("shared_ttl"))   TagIndex::sharedTtl     = tags["shared_ttl"].asUInt();
+    }
+    std::shared_ptr<Abstracts::AbstractCache> backend{};
+    const auto type = section.isMember("backend") ? STRCOMBINER(section, "backend") : "memory";
+    if(type == "redis") {
+        const auto redis = section["redis"];
+        RedisCacheOptions options{};
+        if(redis.isMember("host"))              options.host            = STRCOMBINER(redis, "host");
+        if(redis.isMember("port"))              options.port            = static_cast<u16>(redis["port"].asUInt());
+        if(redis.isMember("password"))          options.password        = STRCOMBINER(redis, "password");
+        if(redis.isMember("database"))          options.database        = redis["database"].asUInt();
+        if(redis.isMember("connections"))       options.connections     = redis["connections"].asUInt();
+        if(redis.isMember("prefix"))            options.prefix          = STRCOMBINER(redis, "prefix");
+        if(redis.isMember("channel"))           options.channel         = STRCOMBINER(redis, "channel");
+        if(redis.isMember("near_capacity_mb"))  options.nearCapacity    = redis["near_capacity_mb"].asUInt64() * MEGABYTE;
+        if(redis.isMember("near_ttl"))          options.nearTtl         = redis["near_ttl"].asUInt();
+        if(redis.isMember("timeout"))           options.timeout         = redis["timeout"].asUInt();
+        auto cache = std::make_shared<RedisCache>(options);
+        if(cache->isConnected()) {
+            backend = cache;
+        } else {
+            eLogger::Log("Redis cache is not available, the memory cache is used instead.", eLogger::LoggerType::Warning);
+        }
+    }
+    if(type == "database") {
+        const auto table = section["database"];
+        TableCacheOptions options{};
+        if(table.isMember("flush_interval"))    options.flushInterval   = table["flush_interval"].asUInt();
+        if(table.isMember("batch_size"))        options.batchSize       = table["batch_size"].asUInt();
+        if(table.isMember("max_pending"))       options.maxPending      = table["max_pending"].asUInt();
+        if(table.isMember("sweep_interval"))    options.sweepInterval   = table["sweep_interval"].asUInt();
+        if(table.isMember("near_capacity_mb"))  options.nearCapacity    = table["near_capacity_mb"].asUInt64() * MEGABYTE;
+        if(table.isMember("near_ttl"))          options.nearTtl         = table["near_ttl"].asUInt();
+        if(table.isMember("max_retries"))       options.maxRetries      = table["max_retries"].asUInt();
+        backend = std::make_shared<TableCache>(options);
+    }
+    if(backend == nullptr) {
+        MemoryCacheOptions options{};
+        if(section.isMember("shards"))         options.shards          = section["shards"].asUInt();
+        if(section.isMember("capacity_mb"))    options.capacity        = section["capacity_mb"].asUInt64() * MEGABYTE;
+        if(section.isMember("sweep_interval")) options.sweepInterval   = section["sweep_interval"].asUInt();
+        if(section.isMember("admission"))      options.admission       = BOOLCOMBINER(section, "admission");
+        if(section.isMember("window"))         options.window          = DBLCOMBINER(section, "window");
+        if(section.isMember("refresh_workers")) options.refreshWorkers = section["refresh_workers"].asUInt();
+        if(section.isMember("refresh_queue"))  options.refreshQueue    = section["refresh_queue"].asUInt();
+        const auto namespaces = section["namespaces"];
+        for(const auto& name : namespaces.getMemberNames()) {
+            options.namespaces.push_back(CacheNamespace { name, namespaces[name].asUInt64() * MEGABYTE });
+        }
+        auto cache = std::make_shared<MemoryCache>(options);
+        if(section.isMember("storage") && !STRCOMBINER(section, "storage").empty()) {
+            Abstracts::CacheMembers members{};
+            members.storage = STRCOMBINER(section, "storage");
+            auto storage = std::make_shared<DiskCache>(members);
+            if(storage->isOpen()) {
+                cache->attachStorage(storage);
+            }
+        }
+        backend = cache;
+    }
+    //! Redis and the database table are shared, and the tag index of another process does not see the invalidations of this one.
+    TagIndex::shared = std::dynamic_pointer_cast<MemoryCache>(backend) == nullptr;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_current.store(backend.get(), std::memory_order_release);
+    m_backends.push_back(std::move(backend));
+}
+
+Abstracts::AbstractCache& CacheManager::instance()
+{
+    if(auto* current = m_current.load(std::memory_order_acquire)) {
+        return *current;
+    }
+    return MemoryCache::instance();
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,53 @@
+/*!
+ * @file        manager.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Selection of the cache shared by the application.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_CACHE_MANAGER_HPP
+#define TEGRA_CACHE_MANAGER_HPP
+
+//! Tegra's Memory Cache.
+#ifdef __has_include
+# if __has_include("memory.hpp")
+#   include "memory.hpp"
+#else
+#   error "Tegra's memory cache was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+/*!
+ * @brief The CacheManager class builds the cache of the application from the "cache" section of the system config.
+ * "backend" is "memory" (default), "redis" or "database"; "storage" attaches the disk tier to the eternal key space of the memory cache.
+ */
+class __tegra_export CacheManager final
+{
+public:
+    /*!
+     * @brief configure function builds the backend; a previous one is kept alive for the readers still holding it.
+     * @param section is the "cache" section.
+     */
+    static void configure(const JSonData& section);
+
+    /*!
+     * @brief instance function returns the configured cache, or the shared memory cache before configure.
+     */
+    __tegra_no_discard static Abstracts::AbstractCache& instance();
+
+private:
+    __tegra_inline_static std::mutex                                                m_mutex     {};
+    __tegra_inline_static std::atomic<Abstracts::AbstractCache*>                    m_current   {nullptr};
+    __tegra_inline_static std::vector<std::shared_ptr<Abstracts::AbstractCache>>    m_backends  {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_CACHE_MANAGER_HPP
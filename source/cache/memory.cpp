@@ -0,0 +1,573 @@
+//! Tegra's Memory Cache.
+#ifdef __has_include
+# if __has_include("memory.hpp")
+#   include "memory.hpp"
+#else
+#   error "Tegra's memory cache was not found!"
+# endif
+#endif
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include(<database>)
+#   include <database>
+#else
+#   error "The database of Tegra was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::Database;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+//! Bookkeeping of one entry (node, ring link and buffer header), counted against the capacity.
+constexpr u64 ENTRY_OVERHEAD = 128;
+
+//! Marks keys of the eternal key space.
+constexpr char ETERNAL_MARK = '\x1e';
+
+//! Rows of the frequency sketch and the largest value of a counter.
+constexpr std::size_t SKETCH_DEPTH = 4;
+constexpr u8 SKETCH_MAX = 15;
+constexpr std::array<u64, SKETCH_DEPTH> SKETCH_SEEDS = { 0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull, 0xD6E8FEB86659FD93ull };
+
+s64 steadyMilliseconds() __tegra_noexcept
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool isExpired(s64 at, s64 now) __tegra_noexcept
+{
+    return at != __tegra_zero && now >= at;
+}
+
+//! Seconds a promoted value is kept when the storage tier does not tell how long it lives.
+constexpr u32 PROMOTION_TTL = 60;
+
+//! Share of the ttl at the end of which a fresh value may be refreshed early.
+constexpr double EARLY_WINDOW = 0.1;
+
+bool refreshEarly(s64 expiresIn, u32 ttl)
+{
+    const double window = static_cast<double>(ttl) * 1000.0 * EARLY_WINDOW;
+    if(expiresIn == __tegra_zero || window <= 0.0 || static_cast<double>(expiresIn) >= window) {
+        return false;
+    }
+    thread_local std::mt19937 engine{ std::random_device{}() };
+    return std::uniform_real_distribution<double>(0.0, 1.0)(engine) > static_cast<double>(expiresIn) / window;
+}
+
+TEGRA_NAMESPACE_END
+
+MemoryCache::MemoryCache() : MemoryCache(MemoryCacheOptions{})
+{
+}
+
+MemoryCache::Sketch::Sketch(std::size_t width) : counters(width * SKETCH_DEPTH), mask(width - 1), sampleSize(width * 10)
+{
+}
+
+void MemoryCache::Sketch::increment(u64 hash) __tegra_noexcept
+{
+    for(std::size_t i = 0; i < SKETCH_DEPTH; ++i) {
+        auto& counter = counters[i * (mask + 1) + (((hash ^ SKETCH_SEEDS[i]) * SKETCH_SEEDS[i]) >> 32 & mask)];
+        auto value = counter.load(std::memory_order_relaxed);
+        while(value < SKETCH_MAX && !counter.compare_exchange_weak(value, static_cast<u8>(value + 1), std::memory_order_relaxed)) {}
+    }
+    //! Aging: whoever reaches the sample size halves every counter.
+    if(additions.fetch_add(1, std::memory_order_relaxed) + 1 == sampleSize) {
+        for(auto& counter : counters) {
+            counter.store(static_cast<u8>(counter.load(std::memory_order_relaxed) >> 1), std::memory_order_relaxed);
+        }
+        additions.store(sampleSize / 2, std::memory_order_relaxed);
+    }
+}
+
+u8 MemoryCache::Sketch::estimate(u64 hash) const __tegra_noexcept
+{
+    u8 res = SKETCH_MAX;
+    for(std::size_t i = 0; i < SKETCH_DEPTH; ++i) {
+        res = std::min(res, counters[i * (mask + 1) + (((hash ^ SKETCH_SEEDS[i]) * SKETCH_SEEDS[i]) >> 32 & mask)].load(std::memory_order_relaxed));
+    }
+    return res;
+}
+
+MemoryCache::MemoryCache(const MemoryCacheOptions& options) : m_options(options)
+{
+    m_options.shards = std::bit_ceil(std::max(1u, m_options.shards));
+    m_options.window = std::clamp(m_options.window, 0.0, 1.0);
+    m_shardCapacity = std::max<u64>(1, m_options.capacity / m_options.shards);
+
+    //! Quotas that do not fit are scaled down, so the shared namespace keeps a tenth of the cache.
+    u64 reserved{};
+    for(const auto& n : m_options.namespaces) reserved += n.quota;
+    const double scale = reserved != __tegra_zero && reserved > m_options.capacity * 9 / 10
+        ? static_cast<double>(m_options.capacity) * 0.9 / static_cast<double>(reserved) : 1.0;
+    std::vector<u64> capacities(m_options.namespaces.size() + 1);
+    u64 quotas{};
+    for(std::size_t i = 0; i < m_options.namespaces.size(); ++i) {
+        capacities[i + 1] = std::max<u64>(1, static_cast<u64>(static_cast<double>(m_options.namespaces[i].quota) * scale) / m_options.shards);
+        quotas += capacities[i + 1];
+    }
+    capacities[0] = m_shardCapacity > quotas ? m_shardCapacity - quotas : 1;
+    for(std::size_t i = 0; i < capacities.size(); ++i) {
+        m_counters.push_back(CreateScope<Counters>());
+    }
+
+    const auto width = std::bit_ceil(std::clamp<u64>(m_shardCapacity / 1024, 256, 1 << 20));
+    m_shards.reserve(m_options.shards);
+    for(u32 i = 0; i < m_options.shards; ++i) {
+        auto shard = CreateScope<Shard>(static_cast<std::size_t>(width));
+        shard->regions.resize(capacities.size());
+        for(std::size_t r = 0; r < capacities.size(); ++r) {
+            auto& region = shard->regions[r];
+            region.capacity         = capacities[r];
+            region.windowCapacity   = static_cast<u64>(static_cast<double>(capacities[r]) * m_options.window);
+            region.hand             = region.main.end();
+        }
+        m_shards.push_back(std::move(shard));
+    }
+    for(u32 i = 0; i < std::max(1u, m_options.refreshWorkers); ++i) {
+        m_refreshers.emplace_back([this](std::stop_token token) {
+            while(true) {
+                std::function<void(bool)> refresh{};
+                {
+                    std::unique_lock<std::mutex> lock(m_refreshMutex);
+                    if(!m_refreshSignal.wait(lock, token, [this]() { return !m_refreshQueue.empty(); }) || token.stop_requested()) {
+                        return;
+                    }
+                    refresh = std::move(m_refreshQueue.front());
+                    m_refreshQueue.pop_front();
+                }
+                refresh(true);
+            }
+        });
+    }
+    if(m_options.sweepInterval != __tegra_zero) {
+        m_sweeper = std::jthread([this](std::stop_token token) {
+            std::unique_lock<std::mutex> lock(m_sweepMutex);
+            while(!token.stop_requested()) {
+                m_sweepSignal.wait_for(lock, token, std::chrono::seconds(m_options.sweepInterval), []() { return false; });
+                if(token.stop_requested()) break;
+                lock.unlock();
+                sweep();
+                lock.lock();
+            }
+        });
+    }
+}
+
+MemoryCache::~MemoryCache()
+{
+    //! Background refreshes write into the shards as well; the running ones finish, the queued ones are settled without a load.
+    for(auto& refresher : m_refreshers) {
+        refresher.request_stop();
+    }
+    for(auto& refresher : m_refreshers) {
+        refresher.join();
+    }
+    for(auto& refresh : m_refreshQueue) {
+        refresh(false);
+    }
+    //! The sweeper touches the shards, so it is stopped before they go away.
+    if(m_sweeper.joinable()) {
+        m_sweeper.request_stop();
+        m_sweeper.join();
+    }
+}
+
+MemoryCache::Shard& MemoryCache::shardOf(const std::string& key) const
+{
+    return *m_shards[std::hash<std::string>{}(key) & (m_shards.size() - 1)];
+}
+
+std::string MemoryCache::slot(const std::string& key, bool eternal)
+{
+    return eternal ? ETERNAL_MARK + key : key;
+}
+
+u16 MemoryCache::regionOf(const std::string& key) const __tegra_noexcept
+{
+    const auto separator = key.find(':');
+    if(separator == std::string::npos || m_options.namespaces.empty()) {
+        return 0;
+    }
+    const std::string_view name(key.data(), separator);
+    for(std::size_t i = 0; i < m_options.namespaces.size(); ++i) {
+        if(m_options.namespaces[i].name == name) return static_cast<u16>(i + 1);
+    }
+    return 0;
+}
+
+void MemoryCache::erase(Shard& shard, std::unordered_map<std::string, Entry>::iterator it)
+{
+    auto& region = shard.regions[it->second.region];
+    if(it->second.main) {
+        if(region.hand == it->second.position) {
+            region.hand = std::next(region.hand);
+        }
+        region.main.erase(it->second.position);
+        region.mainBytes -= it->second.size;
+    } else {
+        region.window.erase(it->second.position);
+        region.windowBytes -= it->second.size;
+    }
+    shard.bytes -= it->second.size;
+    shard.entries.erase(it);
+}
+
+void MemoryCache::evict(Shard& shard, std::unordered_map<std::string, Entry>::iterator it)
+{
+    m_counters[it->second.region]->evictions.fetch_add(1, std::memory_order_relaxed);
+    m_evictions.fetch_add(1, std::memory_order_relaxed);
+    erase(shard, it);
+}
+
+std::unordered_map<std::string, MemoryCache::Entry>::iterator MemoryCache::victim(Shard& shard, Region& region, s64 now)
+{
+    //! Every entry is visited at most twice: once to clear its reference bit and once to pick it.
+    for(std::size_t steps = 0; steps <= region.main.size() * 2 && !region.main.empty(); ++steps) {
+        if(region.hand == region.main.end()) {
+            region.hand = region.main.begin();
+        }
+        auto it = shard.entries.find(*region.hand);
+        if(!isExpired(it->second.expiresAt, now) && it->second.referenced.exchange(false, std::memory_order_relaxed)) {
+            ++region.hand;
+            continue;
+        }
+        return it;
+    }
+    return shard.entries.end();
+}
+
+void MemoryCache::rebalance(Shard& shard, u16 index, s64 now)
+{
+    auto& region = shard.regions[index];
+    const u64 mainCapacity = region.capacity - std::min(region.capacity, region.windowCapacity);
+    while(region.windowBytes > region.windowCapacity && !region.window.empty()) {
+        auto candidate = shard.entries.find(region.window.front());
+        const auto frequency = shard.sketch.estimate(std::hash<std::string>{}(candidate->first));
+        bool admitted = !isExpired(candidate->second.dropAt, now) && candidate->second.size <= mainCapacity;
+        while(admitted && region.mainBytes + candidate->second.size > mainCapacity) {
+            auto it = victim(shard, region, now);
+            if(it == shard.entries.end()) {
+                admitted = false;
+                break;
+            }
+            //! A tie keeps the resident entry, which is what turns scans and one-hit wonders away.
+            if(m_options.admission && !isExpired(it->second.dropAt, now) && frequency <= shard.sketch.estimate(std::hash<std::string>{}(it->first))) {
+                admitted = false;
+                break;
+            }
+            evict(shard, it);
+        }
+        if(!admitted) {
+            m_counters[index]->rejections.fetch_add(1, std::memory_order_relaxed);
+            erase(shard, candidate);
+            continue;
+        }
+        auto& entry = candidate->second;
+        region.window.erase(entry.position);
+        region.windowBytes -= entry.size;
+        entry.position = region.main.insert(region.hand, candidate->first);
+        entry.main = true;
+        region.mainBytes += entry.size;
+    }
+}
+
+bool MemoryCache::store(const std::string& key, CacheBuffer value, u32 ttl, bool eternal, int insur)
+{
+    if(value == nullptr) {
+        return false;
+    }
+    auto name = slot(key, eternal);
+    const auto index = regionOf(key);
+    const u64 size = name.size() + value->size() + ENTRY_OVERHEAD;
+    auto& shard = shardOf(name);
+    if(size > shard.regions[index].capacity) {
+        m_counters[index]->rejections.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    const auto now = steadyMilliseconds();
+    s64 expiresAt{}, dropAt{};
+    if(ttl != __tegra_zero) {
+        const s64 lifetime = static_cast<s64>(ttl) * 1000;
+        const s64 insurance = insur < 0 ? lifetime * 2 : std::max<s64>(lifetime, static_cast<s64>(insur) * 1000);
+        expiresAt = now + lifetime;
+        //! An eternal value is not served past its time, it is read back from the storage tier instead.
+        dropAt = eternal ? expiresAt : now + insurance;
+    }
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.entries.find(name);
+    if(it != shard.entries.end()) {
+        erase(shard, it);
+    }
+    auto& region = shard.regions[index];
+    auto position = region.window.insert(region.window.end(), name);
+    auto& entry = shard.entries[name];
+    entry.value     = std::move(value);
+    entry.expiresAt = expiresAt;
+    entry.dropAt    = dropAt;
+    entry.size      = size;
+    entry.region    = index;
+    entry.position  = position;
+    region.windowBytes += size;
+    shard.bytes += size;
+    rebalance(shard, index, now);
+    return shard.entries.contains(name);
+}
+
+OptionalBool MemoryCache::put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur)
+{
+    if(eternal && m_storage != nullptr && !m_storage->put(key, value, ttl, true, insur).value_or(false)) {
+        return false;
+    }
+    const bool stored = store(key, std::make_shared<const std::string>(value), ttl, eternal, insur);
+    //! An eternal value refused by the filter is still kept by the storage tier.
+    return stored || (eternal && m_storage != nullptr);
+}
+
+std::optional<CacheItem> MemoryCache::lookup(const std::string& key, bool eternal) const
+{
+    const auto name = slot(key, eternal);
+    auto& shard = shardOf(name);
+    auto& counters = *m_counters[regionOf(key)];
+    const auto now = steadyMilliseconds();
+    //! Misses are counted too, so a key that keeps coming back earns its admission.
+    shard.sketch.increment(std::hash<std::string>{}(name));
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.entries.find(name);
+    if(it == shard.entries.end() || isExpired(it->second.dropAt, now)) {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        counters.misses.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    it->second.referenced.store(true, std::memory_order_relaxed);
+    const bool stale = isExpired(it->second.expiresAt, now);
+    (stale ? m_misses : m_hits).fetch_add(1, std::memory_order_relaxed);
+    (stale ? counters.misses : counters.hits).fetch_add(1, std::memory_order_relaxed);
+    const s64 expiresIn = it->second.expiresAt == __tegra_zero || stale ? __tegra_zero : it->second.expiresAt - now;
+    return CacheItem { it->second.value, stale, expiresIn };
+}
+
+CacheBuffer MemoryCache::find(const std::string& key, bool eternal) const
+{
+    auto item = lookup(key, eternal);
+    if(!item.has_value() || item->stale) {
+        return nullptr;
+    }
+    return item->value;
+}
+
+OptionalString MemoryCache::get(const std::string& key, const bool eternal)
+{
+    auto value = find(key, eternal);
+    if(value == nullptr && eternal && m_storage != nullptr) {
+        //! A miss of the eternal key space is promoted from the storage tier.
+        if(auto stored = m_storage->get(key, true); stored.has_value()) {
+            value = std::make_shared<const std::string>(std::move(stored.value()));
+            //! The copy expires with the stored value, so it does not outlive it.
+            store(key, value, m_storage->ttlOf(key, true).value_or(PROMOTION_TTL), true);
+        }
+    }
+    if(value == nullptr) {
+        return std::nullopt;
+    }
+    return *value;
+}
+
+OptionalBool MemoryCache::deleteCache(const std::string& key, const bool eternal)
+{
+    bool stored = false;
+    if(eternal && m_storage != nullptr) {
+        stored = m_storage->deleteCache(key, true).value_or(false);
+    }
+    const auto name = slot(key, eternal);
+    auto& shard = shardOf(name);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.entries.find(name);
+    if(it == shard.entries.end()) {
+        return stored;
+    }
+    erase(shard, it);
+    return true;
+}
+
+OptionalBool MemoryCache::obsolete(const std::string& key, const bool eternal)
+{
+    bool stored = false;
+    if(eternal && m_storage != nullptr) {
+        stored = m_storage->obsolete(key, true).value_or(false);
+    }
+    const auto name = slot(key, eternal);
+    auto& shard = shardOf(name);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.entries.find(name);
+    if(it == shard.entries.end()) {
+        return stored;
+    }
+    const auto now = steadyMilliseconds();
+    it->second.expiresAt = now;
+    if(it->second.dropAt == __tegra_zero) {
+        //! An entry without ttl stays readable as stale for one sweep interval.
+        it->second.dropAt = now + static_cast<s64>(std::max(1u, m_options.sweepInterval)) * 1000;
+    }
+    return true;
+}
+
+OptionalString MemoryCache::getOrCompute(const std::string& key, const u32 ttl, const Abstracts::CacheLoader& loader)
+{
+    if(auto item = lookup(key); item.has_value()) {
+        if(item->stale || refreshEarly(item->expiresIn, ttl)) {
+            revalidate(key, ttl, loader);
+        }
+        return *item->value;
+    }
+    return coalesce(key, [&]() -> OptionalString {
+        if(auto value = find(key); value != nullptr) {
+            return *value;
+        }
+        auto value = loader();
+        if(value.has_value()) {
+            store(key, std::make_shared<const std::string>(value.value()), ttl);
+        }
+        return value;
+    });
+}
+
+void MemoryCache::revalidate(const std::string& key, u32 ttl, const Abstracts::CacheLoader& loader)
+{
+    FlightResult pending{};
+    auto flight = claim(key, pending);
+    if(flight == nullptr) {
+        return;
+    }
+    //! The loader reads the database of the tenant that asked, not of the default site.
+    std::function<void(bool)> refresh = [this, key, ttl, flight, loader, tenant = TenantRouter::current()](bool run) {
+        OptionalString value{};
+        if(run) {
+            TenantScope scope(tenant);
+            try {
+                value = loader();
+                if(value.has_value()) {
+                    store(key, std::make_shared<const std::string>(value.value()), ttl);
+                }
+            } catch(...) {
+                //! The stale value stays until its insurance time, the next reader tries again.
+            }
+        }
+        settle(key, flight, value);
+    };
+    {
+        std::lock_guard<std::mutex> lock(m_refreshMutex);
+        if(m_refreshQueue.size() < std::max(1u, m_options.refreshQueue)) {
+            m_refreshQueue.push_back(std::move(refresh));
+            refresh = nullptr;
+        }
+    }
+    if(refresh != nullptr) {
+        //! The workers are behind; the stale value is served and a later reader asks again.
+        refresh(false);
+        return;
+    }
+    m_refreshes.fetch_add(1, std::memory_order_relaxed);
+    m_refreshSignal.notify_one();
+}
+
+void MemoryCache::clear()
+{
+    for(auto& shard : m_shards) {
+        std::unique_lock<std::shared_mutex> lock(shard->mutex);
+        for(auto it = shard->entries.begin(); it != shard->entries.end();) {
+            if(!it->first.empty() && it->first.front() == ETERNAL_MARK) {
+                ++it;
+                continue;
+            }
+            auto current = it++;
+            erase(*shard, current);
+        }
+    }
+}
+
+std::size_t MemoryCache::sweep()
+{
+    std::size_t res{};
+    const auto now = steadyMilliseconds();
+    for(auto& shard : m_shards) {
+        std::unique_lock<std::shared_mutex> lock(shard->mutex);
+        for(auto it = shard->entries.begin(); it != shard->entries.end();) {
+            if(!isExpired(it->second.dropAt, now)) {
+                ++it;
+                continue;
+            }
+            auto current = it++;
+            erase(*shard, current);
+            ++res;
+        }
+    }
+    m_expirations.fetch_add(res, std::memory_order_relaxed);
+    return res;
+}
+
+CacheStats MemoryCache::stats() const
+{
+    CacheStats res{};
+    res.hits        = m_hits.load(std::memory_order_relaxed);
+    res.misses      = m_misses.load(std::memory_order_relaxed);
+    res.evictions   = m_evictions.load(std::memory_order_relaxed);
+    res.expirations = m_expirations.load(std::memory_order_relaxed);
+    res.refreshes   = m_refreshes.load(std::memory_order_relaxed);
+    for(const auto& counters : m_counters) {
+        res.rejections += counters->rejections.load(std::memory_order_relaxed);
+    }
+    for(const auto& shard : m_shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        res.entries += shard->entries.size();
+        res.bytes   += shard->bytes;
+    }
+    return res;
+}
+
+std::vector<NamespaceStats> MemoryCache::namespaces() const
+{
+    std::vector<NamespaceStats> res(m_counters.size());
+    for(std::size_t i = 0; i < res.size(); ++i) {
+        auto& stats = res[i];
+        stats.name          = i == 0 ? __tegra_null_str : m_options.namespaces[i - 1].name;
+        stats.hits          = m_counters[i]->hits.load(std::memory_order_relaxed);
+        stats.misses        = m_counters[i]->misses.load(std::memory_order_relaxed);
+        stats.rejections    = m_counters[i]->rejections.load(std::memory_order_relaxed);
+        stats.evictions     = m_counters[i]->evictions.load(std::memory_order_relaxed);
+    }
+    for(const auto& shard : m_shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        for(std::size_t i = 0; i < res.size(); ++i) {
+            const auto& region = shard->regions[i];
+            res[i].quota    += region.capacity;
+            res[i].entries  += region.window.size() + region.main.size();
+            res[i].bytes    += region.windowBytes + region.mainBytes;
+        }
+    }
+    return res;
+}
+
+u64 MemoryCache::capacity() const __tegra_noexcept
+{
+    return m_shardCapacity * m_shards.size();
+}
+
+MemoryCache& MemoryCache::instance()
+{
+    static MemoryCache cache{};
+    return cache;
+}
+
+void MemoryCache::attachStorage(std::shared_ptr<Abstracts::AbstractCache> storage)
+{
+    m_storage = std::move(storage);
+}
+
+TEGRA_NAMESPACE_END
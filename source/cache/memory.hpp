@@ -0,0 +1,293 @@
+/*!
+ * @file        memory.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Sharded in-memory cache.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_CACHE_MEMORY_HPP
+#define TEGRA_CACHE_MEMORY_HPP
+
+//! Tegra's Abstract Cache.
+#ifdef __has_include
+# if __has_include("abstracts/cache.hpp")
+#   include "abstracts/cache.hpp"
+#else
+#   error "Tegra's cache was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+using CacheBuffer = std::shared_ptr<const std::string>; ///< Immutable value shared by the cache and every reader.
+
+/*!
+ * @brief The CacheNamespace struct reserves a share of a memory cache for the keys starting with "name:".
+ */
+struct CacheNamespace final
+{
+    std::string name    {};     ///< Prefix of the keys, without the colon.
+    u64         quota   {};     ///< Bytes reserved for the namespace.
+};
+
+/*!
+ * @brief The MemoryCacheOptions struct holds the limits of a memory cache.
+ */
+struct MemoryCacheOptions final
+{
+    u32     shards          {16};                   ///< Number of shards, rounded up to a power of two.
+    u64     capacity        {64 * 1024 * 1024};     ///< Upper bound of keys and values in bytes, split evenly between the shards.
+    u32     sweepInterval   {30};                   ///< Seconds between background expiry sweeps, zero disables the sweeper.
+    bool    admission       {true};                 ///< Admit an entry leaving the window only if it is used more often than the one it would evict.
+    double  window          {0.01};                 ///< Share of every namespace taken by the admission window.
+    u32     refreshWorkers  {2};                    ///< Threads that run the background refreshes of getOrCompute.
+    u32     refreshQueue    {1024};                 ///< Refreshes waiting for a worker; beyond it a stale value is served without one.
+    std::vector<CacheNamespace> namespaces {};      ///< Reserved namespaces; the other keys share what the quotas leave.
+};
+
+/*!
+ * @brief The CacheStats struct holds the counters of a cache.
+ */
+struct CacheStats final
+{
+    u64 hits        {};     ///< Lookups that found a fresh value.
+    u64 misses      {};     ///< Lookups that found nothing or an expired value.
+    u64 evictions   {};     ///< Entries dropped to make room.
+    u64 expirations {};     ///< Entries dropped after their insurance time.
+    u64 entries     {};     ///< Entries currently stored.
+    u64 bytes       {};     ///< Bytes currently accounted.
+    u64 refreshes   {};     ///< Background refreshes started by getOrCompute.
+    u64 rejections  {};     ///< Entries refused by the admission filter or larger than their namespace.
+};
+
+/*!
+ * @brief The NamespaceStats struct holds the counters of one namespace of a memory cache.
+ */
+struct NamespaceStats final
+{
+    std::string name        {};     ///< Prefix of the keys; empty for the shared namespace.
+    u64         quota       {};     ///< Bytes reserved for the namespace.
+    u64         hits        {};
+    u64         misses      {};
+    u64         rejections  {};
+    u64         evictions   {};
+    u64         entries     {};
+    u64         bytes       {};
+};
+
+/*!
+ * @brief The CacheItem struct is the result of a lookup that accepts expired values.
+ */
+struct CacheItem final
+{
+    CacheBuffer value   {};         ///< Stored value.
+    bool        stale   {false};    ///< The time to live has passed, but not the insurance time.
+    s64         expiresIn {};       ///< Milliseconds left of the time to live, zero for values that never expire.
+};
+
+/*!
+ * @brief The MemoryCache class is a byte-bounded in-memory cache split into independently locked shards.
+ * Keys are grouped into namespaces by the prefix before their first colon; each namespace owns a byte quota, so it only ever evicts its own entries.
+ * Within a namespace the policy is W-TinyLFU: a new entry enters a small FIFO window, and an entry leaving the window replaces the CLOCK victim
+ * of the main region only if a Count-Min sketch of recent accesses estimates it as more frequent. One-hit wonders therefore pass through the window
+ * without flushing the working set.
+ * Readers take a shared lock and only set the reference bit and bump the sketch, so a hit never reorders a list.
+ * Expired entries are skipped by readers and removed by the sweeper thread or by eviction.
+ * Eternal entries live in their own key space, never expire and survive clear().
+ * With an attached storage tier, eternal entries are also written through to it and read back from it on a miss.
+ */
+class __tegra_export MemoryCache final : public Abstracts::AbstractCache
+{
+public:
+    MemoryCache();
+    explicit MemoryCache(const MemoryCacheOptions& options);
+    ~MemoryCache();
+
+    /*!
+     * @brief put function stores a copy of the value.
+     * @param key is the name of the entry.
+     * @param value is the data.
+     * @param ttl is the time to live in seconds, zero never expires.
+     * @param eternal writes to the eternal key space.
+     * @param insur is the time in seconds after which an expired value is dropped, negative means twice the ttl.
+     * @returns false if the value does not fit into its namespace or the admission filter refused it.
+     */
+    OptionalBool put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur) __tegra_override;
+
+    /*!
+     * @brief get function returns a copy of a fresh value.
+     */
+    OptionalString get(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief deleteCache function removes an entry.
+     * @returns true if the entry existed.
+     */
+    OptionalBool deleteCache(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief obsolete function expires an entry now; it stays readable as stale until its insurance time.
+     * @returns true if the entry existed.
+     */
+    OptionalBool obsolete(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief getOrCompute function returns a fresh value, or runs the loader once for all concurrent misses.
+     * A stale value is returned at once while a single background refresh runs the loader on one of the refresh workers.
+     * Within the last tenth of the ttl a fresh value is refreshed early with a probability that grows towards expiry,
+     * so a hot key is renewed before it expires and keys stored together do not expire together.
+     */
+    OptionalString getOrCompute(const std::string& key, const u32 ttl, const Abstracts::CacheLoader& loader) __tegra_override;
+
+    /*!
+     * @brief store function stores a shared value without copying it.
+     * @see put for the parameters.
+     */
+    bool store(const std::string& key, CacheBuffer value, u32 ttl, bool eternal = false, int insur = -1);
+
+    /*!
+     * @brief find function returns a fresh value without copying it.
+     * @returns value or nullptr.
+     */
+    __tegra_no_discard CacheBuffer find(const std::string& key, bool eternal = false) const;
+
+    /*!
+     * @brief lookup function returns a fresh value, or an expired one that is still within its insurance time.
+     */
+    __tegra_no_discard std::optional<CacheItem> lookup(const std::string& key, bool eternal = false) const;
+
+    /*!
+     * @brief clear function removes every entry that is not eternal.
+     */
+    void clear();
+
+    /*!
+     * @brief sweep function removes every entry past its insurance time.
+     * @returns number of removed entries.
+     */
+    std::size_t sweep();
+
+    /*!
+     * @brief stats function returns the counters.
+     */
+    __tegra_no_discard CacheStats stats() const;
+
+    /*!
+     * @brief namespaces function returns the counters of every namespace, the shared one first.
+     */
+    __tegra_no_discard std::vector<NamespaceStats> namespaces() const;
+
+    /*!
+     * @brief capacity function returns the byte bound of the cache.
+     */
+    __tegra_no_discard u64 capacity() const __tegra_noexcept;
+
+    /*!
+     * @brief attachStorage function sets the persistent tier of the eternal key space.
+     * @param storage is the tier, for example a DiskCache; it must be attached before the cache is shared.
+     */
+    void attachStorage(std::shared_ptr<Abstracts::AbstractCache> storage);
+
+    /*!
+     * @brief instance function returns the cache shared by the application.
+     */
+    static MemoryCache& instance();
+
+private:
+    using Ring = std::list<std::string>;
+
+    struct Entry final
+    {
+        CacheBuffer                     value       {};
+        s64                             expiresAt   {};     ///< Steady milliseconds, zero never expires.
+        s64                             dropAt      {};     ///< Steady milliseconds of the insurance time, zero never expires.
+        u64                             size        {};
+        mutable std::atomic<bool>       referenced  {false};
+        u16                             region      {};     ///< Index of the namespace.
+        bool                            main        {false};    ///< Admitted to the main region, otherwise still in the window.
+        Ring::iterator                  position    {};     ///< Position in the window or in the clock ring.
+    };
+
+    /*!
+     * @brief Count-Min sketch of 4 bit counters; all counters are halved every few widths of additions, so old popularity fades.
+     */
+    struct Sketch final
+    {
+        explicit Sketch(std::size_t width);
+        void increment(u64 hash) __tegra_noexcept;
+        __tegra_no_discard u8 estimate(u64 hash) const __tegra_noexcept;
+
+        std::vector<std::atomic<u8>>    counters    {};
+        u64                             mask        {};
+        u64                             sampleSize  {};
+        std::atomic<u64>                additions   {};
+    };
+
+    struct Region final
+    {
+        Ring                            window          {};     ///< New entries in arrival order.
+        Ring                            main            {};     ///< Admitted entries, scanned by the clock hand.
+        Ring::iterator                  hand            {};
+        u64                             windowBytes     {};
+        u64                             mainBytes       {};
+        u64                             windowCapacity  {};
+        u64                             capacity        {};
+    };
+
+    struct Shard final
+    {
+        explicit Shard(std::size_t width) : sketch(width) {}
+
+        mutable std::shared_mutex                   mutex   {};
+        std::unordered_map<std::string, Entry>      entries {};
+        std::vector<Region>                         regions {};     ///< One per namespace, the shared one first.
+        mutable Sketch                              sketch;
+        u64                                         bytes   {};
+    };
+
+    struct Counters final
+    {
+        std::atomic<u64> hits       {};
+        std::atomic<u64> misses     {};
+        std::atomic<u64> rejections {};
+        std::atomic<u64> evictions  {};
+    };
+
+    __tegra_no_discard Shard& shardOf(const std::string& key) const;
+    __tegra_no_discard u16 regionOf(const std::string& key) const __tegra_noexcept;
+    __tegra_no_discard static std::string slot(const std::string& key, bool eternal);
+    void erase(Shard& shard, std::unordered_map<std::string, Entry>::iterator it);
+    void evict(Shard& shard, std::unordered_map<std::string, Entry>::iterator it);
+    void rebalance(Shard& shard, u16 region, s64 now);
+    __tegra_no_discard std::unordered_map<std::string, Entry>::iterator victim(Shard& shard, Region& region, s64 now);
+    void revalidate(const std::string& key, u32 ttl, const Abstracts::CacheLoader& loader);
+
+    MemoryCacheOptions                  m_options   {};
+    u64                                 m_shardCapacity {};
+    std::vector<Scope<Shard>>           m_shards    {};
+    mutable std::atomic<u64>            m_hits      {};
+    mutable std::atomic<u64>            m_misses    {};
+    std::atomic<u64>                    m_evictions {};
+    std::atomic<u64>                    m_expirations {};
+    std::vector<Scope<Counters>>        m_counters  {};     ///< Counters of every namespace.
+    std::atomic<u64>                    m_refreshes {};
+    std::mutex                          m_refreshMutex {};
+    std::condition_variable_any         m_refreshSignal {};
+    std::deque<std::function<void(bool)>> m_refreshQueue {};    ///< Pending refreshes; false settles one without running it.
+    std::vector<std::jthread>           m_refreshers {};
+    std::mutex                          m_sweepMutex {};
+    std::condition_variable_any         m_sweepSignal {};
+    std::jthread                        m_sweeper   {};
+    std::shared_ptr<Abstracts::AbstractCache> m_storage {};     ///< Persistent tier of the eternal entries.
+
+    TEGRA_DISABLE_COPY(MemoryCache)
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_CACHE_MEMORY_HPP
@@ -0,0 +1,324 @@
+//! Tegra's Redis Cache.
+#ifdef __has_include
+# if __has_include("redis.hpp")
+#   include "redis.hpp"
+#else
+#   error "Tegra's redis cache was not found!"
+# endif
+#endif
+
+//! Tegra's Core.
+#ifdef __has_include
+# if __has_include(<core>)
+#   include <core>
+#else
+#   error "Tegra's core was not found!"
+# endif
+#endif
+
+//! Tegra's Logger.
+#ifdef __has_include
+# if __has_include(<logger>)
+#   include <logger>
+#else
+#   error "Tegra's logger was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+/*!
+ * @brief Commands of a batch are sent without waiting for each other; the caller waits for the last reply.
+ */
+struct Batch final
+{
+    explicit Batch(std::size_t size) : pending(size), values(size) {}
+
+    std::atomic<std::size_t>        pending {};
+    std::vector<OptionalString>     values  {};
+    std::atomic<bool>               failed  {false};
+    std::promise<void>              done    {};
+
+    void finish()
+    {
+        if(pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            done.set_value();
+        }
+    }
+};
+
+TEGRA_NAMESPACE_END
+
+RedisCache::RedisCache(const RedisCacheOptions& options) : m_options(options)
+{
+    std::random_device device{};
+    std::ostringstream origin{};
+    origin << std::hex << device() << device();
+    m_origin = origin.str();
+    //! A near copy without expiry would outlive a lost message forever.
+    m_options.nearTtl = std::max(1u, m_options.nearTtl);
+
+    if(m_options.nearCapacity != __tegra_zero) {
+        MemoryCacheOptions near{};
+        near.shards     = 4;
+        near.capacity   = m_options.nearCapacity;
+        near.sweepInterval = m_options.nearTtl;
+        m_near = CreateScope<MemoryCache>(near);
+    }
+    try {
+        m_client = NoSql::RedisClient::newRedisClient(trantor::InetAddress(m_options.host, m_options.port),
+                                                      std::max(1u, m_options.connections), m_options.password, m_options.database);
+    } catch (const std::exception& e) {
+        fail(e.what());
+    }
+    if(m_client != nullptr && m_near != nullptr) {
+        m_subscriber = m_client->newSubscriber();
+        m_subscriber->subscribe(m_options.channel, [this](const std::string&, const std::string& message) {
+            const auto separator = message.find('\n');
+            if(separator == std::string::npos || message.compare(0, separator, m_origin) == 0) {
+                return;
+            }
+            m_near->deleteCache(message.substr(separator + 1), false);
+        });
+    }
+}
+
+RedisCache::~RedisCache()
+{
+    if(m_subscriber != nullptr) {
+        m_subscriber->unsubscribe(m_options.channel);
+        m_subscriber.reset();
+    }
+}
+
+bool RedisCache::isConnected() const __tegra_noexcept
+{
+    if(m_client == nullptr) {
+        return false;
+    }
+    try {
+        //! The client connects lazily, so only an answer proves the server is there.
+        auto reply = std::make_shared<std::promise<bool>>();
+        auto answer = reply->get_future();
+        m_client->execCommandAsync([reply](const NoSql::RedisResult& r) { reply->set_value(r.type() == NoSql::RedisResultType::kStatus && r.asString() == "PONG"); },
+                                   [reply](const NoSql::RedisException&) { reply->set_value(false); }, "PING");
+        return answer.wait_for(std::chrono::milliseconds(m_options.timeout)) == std::future_status::ready && answer.get();
+    } catch (const std::exception& e) {
+        fail(e.what());
+        return false;
+    }
+}
+
+std::string RedisCache::keyOf(const std::string& key, bool eternal) const
+{
+    return m_options.prefix + (eternal ? "e:" : "c:") + key;
+}
+
+void RedisCache::fail(const std::string& message) const
+{
+    if(DeveloperMode::IsEnable) {
+        eLogger::Log("Cache Error: " + message, eLogger::LoggerType::Critical);
+    }
+}
+
+void RedisCache::publish(const std::string& name)
+{
+    //! Other nodes may keep near copies even when this one does not.
+    if(m_client == nullptr) {
+        return;
+    }
+    const auto message = m_origin + "\n" + name;
+    m_client->execCommandAsync([](const NoSql::RedisResult&) {}, [this](const NoSql::RedisException& e) { fail(e.what()); },
+                               "PUBLISH %b %b", m_options.channel.data(), m_options.channel.size(), message.data(), message.size());
+}
+
+OptionalBool RedisCache::put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur)
+{
+    if(m_client == nullptr) {
+        return false;
+    }
+    const auto name = keyOf(key, eternal);
+    try {
+        const auto ok = ttl == __tegra_zero
+            ? m_client->execCommandSync<bool>([](const NoSql::RedisResult& r) { return r.type() == NoSql::RedisResultType::kStatus; },
+                                              "SET %b %b", name.data(), name.size(), value.data(), value.size())
+            : m_client->execCommandSync<bool>([](const NoSql::RedisResult& r) { return r.type() == NoSql::RedisResultType::kStatus; },
+                                              "SET %b %b EX %u", name.data(), name.size(), value.data(), value.size(), ttl);
+        if(!ok) {
+            return false;
+        }
+    } catch (const NoSql::RedisException& e) {
+        fail(e.what());
+        return false;
+    }
+    if(m_near != nullptr) {
+        const auto near = ttl == __tegra_zero ? m_options.nearTtl : std::min(ttl, m_options.nearTtl);
+        m_near->store(name, std::make_shared<const std::string>(value), near, false, static_cast<int>(near));
+    }
+    publish(name);
+    return true;
+}
+
+OptionalString RedisCache::get(const std::string& key, const bool eternal)
+{
+    const auto name = keyOf(key, eternal);
+    if(m_near != nullptr) {
+        if(auto value = m_near->find(name); value != nullptr) {
+            return *value;
+        }
+    }
+    if(m_client == nullptr) {
+        return std::nullopt;
+    }
+    try {
+        auto value = m_client->execCommandSync<OptionalString>([](const NoSql::RedisResult& r) -> OptionalString {
+            if(r.type() != NoSql::RedisResultType::kString) return std::nullopt;
+            return r.asString();
+        }, "GET %b", name.data(), name.size());
+        (value.has_value() ? m_hits : m_misses).fetch_add(1, std::memory_order_relaxed);
+        if(value.has_value() && m_near != nullptr) {
+            m_near->store(name, std::make_shared<const std::string>(value.value()), m_options.nearTtl, false, static_cast<int>(m_options.nearTtl));
+        }
+        return value;
+    } catch (const NoSql::RedisException& e) {
+        fail(e.what());
+        return std::nullopt;
+    }
+}
+
+OptionalBool RedisCache::deleteCache(const std::string& key, const bool eternal)
+{
+    const auto name = keyOf(key, eternal);
+    if(m_near != nullptr) {
+        m_near->deleteCache(name, false);
+    }
+    if(m_client == nullptr) {
+        return false;
+    }
+    try {
+        const auto removed = m_client->execCommandSync<long long>([](const NoSql::RedisResult& r) {
+            return r.type() == NoSql::RedisResultType::kInteger ? r.asInteger() : 0LL;
+        }, "DEL %b", name.data(), name.size());
+        publish(name);
+        return removed > 0;
+    } catch (const NoSql::RedisException& e) {
+        fail(e.what());
+        return false;
+    }
+}
+
+OptionalBool RedisCache::obsolete(const std::string& key, const bool eternal)
+{
+    return deleteCache(key, eternal);
+}
+
+std::vector<OptionalString> RedisCache::getMany(const VectorString& keys, bool eternal)
+{
+    std::vector<OptionalString> res(keys.size());
+    std::vector<std::size_t> missing{};
+    VectorString names{};
+    for(std::size_t i = 0; i < keys.size(); ++i) {
+        auto name = keyOf(keys[i], eternal);
+        if(m_near != nullptr) {
+            if(auto value = m_near->find(name); value != nullptr) {
+                res[i] = *value;
+                continue;
+            }
+        }
+        missing.push_back(i);
+        names.push_back(std::move(name));
+    }
+    if(missing.empty() || m_client == nullptr) {
+        return res;
+    }
+    //! The client takes printf style commands, so the keys go out as one pipeline of GET instead of a variadic MGET.
+    auto batch = std::make_shared<Batch>(names.size());
+    auto done = batch->done.get_future();
+    for(std::size_t i = 0; i < names.size(); ++i) {
+        m_client->execCommandAsync([batch, i](const NoSql::RedisResult& r) {
+            if(r.type() == NoSql::RedisResultType::kString) batch->values[i] = r.asString();
+            batch->finish();
+        }, [this, batch](const NoSql::RedisException& e) {
+            batch->failed.store(true, std::memory_order_relaxed);
+            fail(e.what());
+            batch->finish();
+        }, "GET %b", names[i].data(), names[i].size());
+    }
+    done.wait();
+    for(std::size_t i = 0; i < missing.size(); ++i) {
+        auto& value = batch->values[i];
+        (value.has_value() ? m_hits : m_misses).fetch_add(1, std::memory_order_relaxed);
+        if(value.has_value() && m_near != nullptr) {
+            m_near->store(names[i], std::make_shared<const std::string>(value.value()), m_options.nearTtl, false, static_cast<int>(m_options.nearTtl));
+        }
+        res[missing[i]] = std::move(value);
+    }
+    return res;
+}
+
+bool RedisCache::putMany(const std::vector<std::pair<std::string, std::string>>& items, u32 ttl, bool eternal)
+{
+    if(items.empty()) {
+        return true;
+    }
+    if(m_client == nullptr) {
+        return false;
+    }
+    VectorString names{};
+    names.reserve(items.size());
+    for(const auto& [key, value] : items) {
+        names.push_back(keyOf(key, eternal));
+    }
+    //! MSET can not set an expiry, so the values go out as one pipeline of SET.
+    auto batch = std::make_shared<Batch>(items.size());
+    auto done = batch->done.get_future();
+    for(std::size_t i = 0; i < items.size(); ++i) {
+        const auto& value = items[i].second;
+        auto reply = [batch](const NoSql::RedisResult& r) {
+            if(r.type() != NoSql::RedisResultType::kStatus) batch->failed.store(true, std::memory_order_relaxed);
+            batch->finish();
+        };
+        auto error = [this, batch](const NoSql::RedisException& e) {
+            batch->failed.store(true, std::memory_order_relaxed);
+            fail(e.what());
+            batch->finish();
+        };
+        if(ttl == __tegra_zero) {
+            m_client->execCommandAsync(std::move(reply), std::move(error), "SET %b %b",
+                                       names[i].data(), names[i].size(), value.data(), value.size());
+        } else {
+            m_client->execCommandAsync(std::move(reply), std::move(error), "SET %b %b EX %u",
+                                       names[i].data(), names[i].size(), value.data(), value.size(), ttl);
+        }
+    }
+    done.wait();
+    for(std::size_t i = 0; i < items.size(); ++i) {
+        if(m_near != nullptr) {
+            //! A copy read before this write may be elsewhere; the message drops it there.
+            m_near->deleteCache(names[i], false);
+        }
+        publish(names[i]);
+    }
+    return !batch->failed.load(std::memory_order_relaxed);
+}
+
+CacheStats RedisCache::stats() const
+{
+    CacheStats res = m_near != nullptr ? m_near->stats() : CacheStats{};
+    const auto hits = m_hits.load(std::memory_order_relaxed);
+    if(m_near != nullptr) {
+        //! A near miss that the server answered is a hit of the cache as a whole.
+        res.misses -= std::min(res.misses, hits);
+    } else {
+        res.misses = m_misses.load(std::memory_order_relaxed);
+    }
+    res.hits += hits;
+    return res;
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,116 @@
+/*!
+ * @file        redis.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Cache shared between processes through a Redis compatible server.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_CACHE_REDIS_HPP
+#define TEGRA_CACHE_REDIS_HPP
+
+//! Tegra's Memory Cache.
+#ifdef __has_include
+# if __has_include("memory.hpp")
+#   include "memory.hpp"
+#else
+#   error "Tegra's memory cache was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+/*!
+ * @brief The RedisCacheOptions struct holds the server and the near cache settings.
+ */
+struct RedisCacheOptions final
+{
+    std::string     host            {"127.0.0.1"};
+    u16             port            {6379};
+    std::string     password        {};
+    u32             database        {};
+    u32             connections     {4};                    ///< Size of the connection pool.
+    std::string     prefix          {"tegra:"};             ///< Prefix of every key on the server.
+    std::string     channel         {"tegra:invalidate"};   ///< Channel of the invalidation messages.
+    u64             nearCapacity    {8 * 1024 * 1024};      ///< Byte bound of the in-process copies, zero disables them.
+    u32             nearTtl         {5};                    ///< Seconds a copy is trusted; bounds staleness if a message is lost.
+    u32             timeout         {1000};                 ///< Milliseconds isConnected waits for the answer of the server.
+};
+
+/*!
+ * @brief The RedisCache class keeps the values on a Redis compatible server, so every process and host shares them.
+ * Reads are served from a small in-process near cache first. Every write and delete publishes the key on the channel,
+ * and the other processes drop their copy when the message arrives.
+ * Blocking calls must not be made from an event loop thread of the framework.
+ */
+class __tegra_export RedisCache final : public Abstracts::AbstractCache
+{
+public:
+    explicit RedisCache(const RedisCacheOptions& options = {});
+    ~RedisCache();
+
+    /*!
+     * @brief put function writes the value with SET; the ttl becomes the expiry on the server.
+     */
+    OptionalBool put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur) __tegra_override;
+
+    /*!
+     * @brief get function returns the near copy or reads the value with GET.
+     */
+    OptionalString get(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief deleteCache function removes the value on the server and in every near cache.
+     */
+    OptionalBool deleteCache(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief obsolete function removes the value, the server has no stale state to keep it in.
+     */
+    OptionalBool obsolete(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief getMany function reads several keys in one pipelined round trip, near copies first.
+     * @returns values in the order of the keys.
+     */
+    __tegra_no_discard std::vector<OptionalString> getMany(const VectorString& keys, bool eternal = false);
+
+    /*!
+     * @brief putMany function writes several values in one pipelined round trip.
+     * @returns true if every value was written.
+     */
+    bool putMany(const std::vector<std::pair<std::string, std::string>>& items, u32 ttl, bool eternal = false);
+
+    /*!
+     * @brief stats function returns the counters of the near cache and of the server round trips.
+     */
+    __tegra_no_discard CacheStats stats() const;
+
+    /*!
+     * @brief isConnected checks if the server answers a PING within the timeout.
+     */
+    __tegra_no_discard bool isConnected() const __tegra_noexcept;
+
+private:
+    __tegra_no_discard std::string keyOf(const std::string& key, bool eternal) const;
+    void publish(const std::string& name);
+    void fail(const std::string& message) const;
+
+    RedisCacheOptions                   m_options       {};
+    std::string                         m_origin        {};     ///< Identifier of this process in the messages.
+    Scope<MemoryCache>                  m_near          {};
+    NoSql::RedisClientPtr               m_client        {};
+    std::shared_ptr<NoSql::RedisSubscriber> m_subscriber {};
+    mutable std::atomic<u64>            m_hits          {};     ///< Values found on the server.
+    mutable std::atomic<u64>            m_misses        {};     ///< Keys missing on the server.
+
+    TEGRA_DISABLE_COPY(RedisCache)
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_CACHE_REDIS_HPP
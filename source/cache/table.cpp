@@ -0,0 +1,374 @@
+//! Tegra's Table Cache.
+#ifdef __has_include
+# if __has_include("table.hpp")
+#   include "table.hpp"
+#else
+#   error "Tegra's table cache was not found!"
+# endif
+#endif
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include(<database>)
+#   include <database>
+#else
+#   error "The database of Tegra was not found!"
+# endif
+#endif
+
+//! Tegra's Logger.
+#ifdef __has_include
+# if __has_include(<logger>)
+#   include <logger>
+#else
+#   error "Tegra's logger was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+TEGRA_USING_NAMESPACE Tegra::Database;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+s64 wallSeconds() __tegra_noexcept
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+bool isExpired(s64 at) __tegra_noexcept
+{
+    return at != __tegra_zero && wallSeconds() >= at;
+}
+
+std::string placeholder(Orm::ClientType type, std::size_t index)
+{
+    return type == Orm::ClientType::PostgreSQL ? "$" + TO_TEGRA_STRING(index) : "?";
+}
+
+TEGRA_NAMESPACE_END
+
+TableCache::TableCache(const TableCacheOptions& options) : m_options(options)
+{
+    m_options.batchSize = std::max(1u, m_options.batchSize);
+    m_options.nearTtl   = std::max(1u, m_options.nearTtl);
+    if(m_options.nearCapacity != __tegra_zero) {
+        MemoryCacheOptions near{};
+        near.shards         = 4;
+        near.capacity       = m_options.nearCapacity;
+        near.sweepInterval  = m_options.nearTtl;
+        m_near = CreateScope<MemoryCache>(near);
+    }
+    m_worker = std::jthread([this](std::stop_token token) {
+        auto lastSweep = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(!token.stop_requested()) {
+            m_signal.wait_for(lock, token, std::chrono::milliseconds(std::max(1u, m_options.flushInterval)),
+                              [this]() { return m_pending.size() >= m_options.batchSize; });
+            lock.unlock();
+            flush();
+            if(m_options.sweepInterval != __tegra_zero
+                && std::chrono::steady_clock::now() - lastSweep >= std::chrono::seconds(m_options.sweepInterval)) {
+                sweep();
+                lastSweep = std::chrono::steady_clock::now();
+            }
+            lock.lock();
+        }
+    });
+}
+
+TableCache::~TableCache()
+{
+    if(m_worker.joinable()) {
+        m_worker.request_stop();
+        m_worker.join();
+    }
+    //! The last flush of the worker may have run before the final puts.
+    flush();
+}
+
+std::string TableCache::keyOf(const std::string& key, bool eternal)
+{
+    return (eternal ? "e:" : "c:") + key;
+}
+
+bool TableCache::prepare()
+{
+    if(m_prepared.load(std::memory_order_acquire)) {
+        return true;
+    }
+    //! The table is created by the migrations when the framework starts; until then the changes stay queued.
+    std::lock_guard<std::mutex> lock(m_prepareMutex);
+    if(m_prepared.load(std::memory_order_acquire)) {
+        return true;
+    }
+    TenantScope scope(std::nullopt);
+    auto clientPtr = Router::writer();
+    if(isNullPtr(clientPtr)) {
+        return false;
+    }
+    const auto table = FROM_TEGRA_STRING(TableRegistry::name(TEGRA_TABLES::CACHE));
+    try {
+        clientPtr->execSqlSync("SELECT name FROM " + table + " WHERE 1 = 0");
+    } catch (const SqlException&) {
+        return false;
+    }
+    m_table = table;
+    m_prepared.store(true, std::memory_order_release);
+    return true;
+}
+
+bool TableCache::enqueue(std::string name, Change change)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_pending.find(name);
+    if(it == m_pending.end() && m_pending.size() >= m_options.maxPending) {
+        m_signal.notify_all();
+        return false;
+    }
+    if(it != m_pending.end()) {
+        it->second = std::move(change);
+    } else {
+        m_pending.emplace(std::move(name), std::move(change));
+    }
+    if(m_pending.size() >= m_options.batchSize) {
+        m_signal.notify_all();
+    }
+    return true;
+}
+
+OptionalBool TableCache::put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur)
+{
+    auto name = keyOf(key, eternal);
+    if(!enqueue(name, Change { value, ttl == __tegra_zero ? __tegra_zero : wallSeconds() + ttl })) {
+        return false;
+    }
+    if(m_near != nullptr) {
+        const auto near = ttl == __tegra_zero ? m_options.nearTtl : std::min(ttl, m_options.nearTtl);
+        m_near->store(name, std::make_shared<const std::string>(value), near, false, static_cast<int>(near));
+    }
+    return true;
+}
+
+OptionalString TableCache::get(const std::string& key, const bool eternal)
+{
+    const auto name = keyOf(key, eternal);
+    if(m_near != nullptr) {
+        if(auto value = m_near->find(name); value != nullptr) {
+            return *value;
+        }
+    }
+    {
+        //! A queued change is newer than one being flushed, which is newer than the row.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const Change* change{nullptr};
+        if(auto it = m_pending.find(name); it != m_pending.end()) {
+            change = &it->second;
+        } else if(auto flushed = m_inflight.find(name); flushed != m_inflight.end()) {
+            change = &flushed->second;
+        }
+        if(change != nullptr) {
+            if(!change->value.has_value() || isExpired(change->expiresAt)) {
+                return std::nullopt;
+            }
+            return change->value;
+        }
+    }
+    if(!prepare()) {
+        return std::nullopt;
+    }
+    TenantScope scope(std::nullopt);
+    auto clientPtr = Router::writer();
+    if(isNullPtr(clientPtr)) {
+        return std::nullopt;
+    }
+    try {
+        const auto result = clientPtr->execSqlSync("SELECT value, expires_at FROM " + m_table + " WHERE name = " + placeholder(clientPtr->type(), 1), name);
+        if(result.empty()) {
+            return std::nullopt;
+        }
+        const auto expiresAt = result[0]["expires_at"].as<s64>();
+        if(isExpired(expiresAt)) {
+            return std::nullopt;
+        }
+        auto value = result[0]["value"].as<std::string>();
+        if(m_near != nullptr) {
+            const auto left = expiresAt == __tegra_zero ? m_options.nearTtl : static_cast<u32>(std::max<s64>(1, std::min<s64>(expiresAt - wallSeconds(), m_options.nearTtl)));
+            m_near->store(name, std::make_shared<const std::string>(value), left, false, static_cast<int>(left));
+        }
+        return value;
+    } catch (const SqlException& e) {
+        if(DeveloperMode::IsEnable)
+            eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+        return std::nullopt;
+    }
+}
+
+OptionalBool TableCache::deleteCache(const std::string& key, const bool eternal)
+{
+    auto name = keyOf(key, eternal);
+    if(m_near != nullptr) {
+        m_near->deleteCache(name, false);
+    }
+    return enqueue(std::move(name), Change{});
+}
+
+OptionalBool TableCache::obsolete(const std::string& key, const bool eternal)
+{
+    return deleteCache(key, eternal);
+}
+
+std::size_t TableCache::write(Batch& changes, std::size_t& failed)
+{
+    failed = __tegra_zero;
+    TenantScope scope(std::nullopt);
+    auto clientPtr = Router::writer();
+    if(isNullPtr(clientPtr)) {
+        return __tegra_zero;
+    }
+    const auto type = clientPtr->type();
+    //! Changes that failed before go first and one by one, so a row the database refuses can not hold back a whole batch.
+    const auto group = [](const auto& c) { return (c.second->attempts != __tegra_zero ? 0 : 2) + (c.second->value.has_value() ? 0 : 1); };
+    std::stable_sort(changes.begin(), changes.end(), [&group](const auto& a, const auto& b) { return group(a) < group(b); });
+    const auto run = [&](const std::string& sql, std::size_t from, std::size_t rows, bool upsert) -> bool {
+        std::optional<SqlResult> result{};
+        std::string error{};
+        {
+            //! Rows have a runtime arity, so they are bound one by one; the blocking binder executes when it goes out of scope.
+            auto binder = *clientPtr << sql;
+            for(std::size_t i = from; i < from + rows; ++i) {
+                binder << *changes[i].first;
+                if(upsert) {
+                    binder << changes[i].second->value.value();
+                    binder << changes[i].second->expiresAt;
+                }
+            }
+            binder << Orm::Mode::Blocking;
+            binder >> [&result](const SqlResult& r) { result = r; };
+            binder >> [&error](const SqlException& e) { error = e.base().what(); };
+        }
+        m_statements.fetch_add(1, std::memory_order_relaxed);
+        if(!result.has_value()) {
+            m_failures.fetch_add(1, std::memory_order_relaxed);
+            if(DeveloperMode::IsEnable)
+                eLogger::Log("Database Error: " + error, eLogger::LoggerType::Critical);
+            return false;
+        }
+        m_rows.fetch_add(rows, std::memory_order_relaxed);
+        return true;
+    };
+    //! Every key appears once per flush, so one statement never touches a row twice.
+    std::size_t from{};
+    while(from < changes.size()) {
+        const auto kind = group(changes[from]);
+        const bool upsert = changes[from].second->value.has_value();
+        const std::size_t step = changes[from].second->attempts != __tegra_zero ? 1 : m_options.batchSize;
+        std::size_t rows{};
+        while(rows < step && from + rows < changes.size() && group(changes[from + rows]) == kind) ++rows;
+        std::string sql{};
+        if(upsert) {
+            sql = "INSERT INTO " + m_table + " (name, value, expires_at) VALUES ";
+            for(std::size_t r = 0, index = 1; r < rows; ++r, index += 3) {
+                sql += (r == 0 ? "(" : ", (") + placeholder(type, index) + ", " + placeholder(type, index + 1) + ", " + placeholder(type, index + 2) + ")";
+            }
+            sql += type == Orm::ClientType::Mysql
+                ? " ON DUPLICATE KEY UPDATE value = VALUES(value), expires_at = VALUES(expires_at)"
+                : " ON CONFLICT (name) DO UPDATE SET value = excluded.value, expires_at = excluded.expires_at";
+        } else {
+            sql = "DELETE FROM " + m_table + " WHERE name IN (";
+            for(std::size_t r = 0; r < rows; ++r) {
+                sql += (r == 0 ? "" : ", ") + placeholder(type, r + 1);
+            }
+            sql += ")";
+        }
+        if(!run(sql, from, rows, upsert)) {
+            failed = rows;
+            break;
+        }
+        from += rows;
+    }
+    return from;
+}
+
+bool TableCache::flush()
+{
+    std::lock_guard<std::mutex> flushLock(m_flushMutex);
+    Batch changes{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_pending.empty()) {
+            return true;
+        }
+    }
+    //! Until the table exists the changes stay queued and readable.
+    if(!prepare()) {
+        return false;
+    }
+    {
+        //! The changes stay readable while they are written; nothing else touches the in-flight map during the write.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inflight.swap(m_pending);
+        changes.reserve(m_inflight.size());
+        for(auto& change : m_inflight) {
+            changes.emplace_back(&change.first, &change.second);
+        }
+    }
+    std::size_t failed{};
+    const auto written = write(changes, failed);
+    m_flushes.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(std::size_t i = written; i < changes.size(); ++i) {
+        auto change = std::move(*changes[i].second);
+        if(i < written + failed && ++change.attempts >= std::max(1u, m_options.maxRetries)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            if(DeveloperMode::IsEnable)
+                eLogger::Log("Cache change of [" + *changes[i].first + "] has been dropped after " + TO_TEGRA_STRING(change.attempts) + " failed writes!", eLogger::LoggerType::Warning);
+            continue;
+        }
+        //! Failed changes are queued again unless a newer one arrived meanwhile.
+        m_pending.try_emplace(*changes[i].first, std::move(change));
+    }
+    m_inflight.clear();
+    return written == changes.size();
+}
+
+u64 TableCache::sweep()
+{
+    if(!prepare()) {
+        return __tegra_zero;
+    }
+    TenantScope scope(std::nullopt);
+    auto clientPtr = Router::writer();
+    if(isNullPtr(clientPtr)) {
+        return __tegra_zero;
+    }
+    try {
+        const auto result = clientPtr->execSqlSync("DELETE FROM " + m_table + " WHERE expires_at > 0 AND expires_at <= "
+                                                   + placeholder(clientPtr->type(), 1), wallSeconds());
+        const auto res = static_cast<u64>(result.affectedRows());
+        m_swept.fetch_add(res, std::memory_order_relaxed);
+        return res;
+    } catch (const SqlException& e) {
+        if(DeveloperMode::IsEnable)
+            eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+        return __tegra_zero;
+    }
+}
+
+TableCacheStats TableCache::stats() const
+{
+    TableCacheStats res{};
+    res.flushes     = m_flushes.load(std::memory_order_relaxed);
+    res.statements  = m_statements.load(std::memory_order_relaxed);
+    res.rows        = m_rows.load(std::memory_order_relaxed);
+    res.failures    = m_failures.load(std::memory_order_relaxed);
+    res.dropped     = m_dropped.load(std::memory_order_relaxed);
+    res.swept       = m_swept.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    res.pending     = m_pending.size();
+    return res;
+}
+
+TEGRA_NAMESPACE_END
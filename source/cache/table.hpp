@@ -0,0 +1,144 @@
+/*!
+ * @file        table.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Cache stored in the cache table of the database.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_CACHE_TABLE_HPP
+#define TEGRA_CACHE_TABLE_HPP
+
+//! Tegra's Memory Cache.
+#ifdef __has_include
+# if __has_include("memory.hpp")
+#   include "memory.hpp"
+#else
+#   error "Tegra's memory cache was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+/*!
+ * @brief The TableCacheOptions struct holds the write-behind and near cache settings.
+ */
+struct TableCacheOptions final
+{
+    u32 flushInterval   {200};              ///< Milliseconds between write-behind flushes.
+    u32 batchSize       {256};              ///< Rows per UPSERT statement; a full batch is flushed at once.
+    u32 maxPending      {10000};            ///< Pending writes after which put is refused until a flush drains the queue.
+    u32 sweepInterval   {60};               ///< Seconds between deletes of expired rows.
+    u64 nearCapacity    {8 * 1024 * 1024};  ///< Byte bound of the in-process copies, zero disables them.
+    u32 nearTtl         {5};                ///< Seconds a copy is trusted; other processes' writes are seen after it.
+    u32 maxRetries      {3};                ///< Failed writes after which a change is dropped; a change that failed once is retried alone.
+};
+
+/*!
+ * @brief The TableCacheStats struct holds the counters of the write-behind queue.
+ */
+struct TableCacheStats final
+{
+    u64 flushes     {};     ///< Flushes that wrote at least one row.
+    u64 statements  {};     ///< Statements sent by the flushes.
+    u64 rows        {};     ///< Rows written or deleted by the flushes.
+    u64 failures    {};     ///< Failed statements; their rows are queued again.
+    u64 dropped     {};     ///< Changes dropped after maxRetries failed writes.
+    u64 swept       {};     ///< Expired rows deleted by the sweep.
+    u64 pending     {};     ///< Writes waiting for the next flush.
+};
+
+/*!
+ * @brief The TableCache class keeps the values in the cache table, so the cache survives restarts and is shared by every process using the database.
+ * Reads are served from a near cache, then from the writes still waiting in the queue or being flushed, then from the table.
+ * Writes are queued and a background thread flushes them as batched UPSERTs, so a put never waits for a round trip.
+ * Expired rows are deleted by the same thread through the index on expires_at.
+ * The table always lives in the default database, whatever tenant is bound to the caller, and is created by the migrations.
+ */
+class __tegra_export TableCache final : public Abstracts::AbstractCache
+{
+public:
+    explicit TableCache(const TableCacheOptions& options = {});
+    ~TableCache();
+
+    /*!
+     * @brief put function queues the value; the ttl becomes expires_at.
+     * @returns false if the queue is full.
+     */
+    OptionalBool put(const std::string& key, const std::string& value, const u32 ttl, const bool eternal, const int insur) __tegra_override;
+
+    /*!
+     * @brief get function returns the near copy, the queued value or the row.
+     */
+    OptionalString get(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief deleteCache function queues the removal of the row.
+     */
+    OptionalBool deleteCache(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief obsolete function queues the removal of the row, the table keeps no stale state.
+     */
+    OptionalBool obsolete(const std::string& key, const bool eternal) __tegra_override;
+
+    /*!
+     * @brief flush function writes every queued change now.
+     * @returns false if a statement failed; its rows stay queued.
+     */
+    bool flush();
+
+    /*!
+     * @brief sweep function deletes the expired rows.
+     * @returns number of deleted rows.
+     */
+    u64 sweep();
+
+    /*!
+     * @brief stats function returns the counters of the queue.
+     */
+    __tegra_no_discard TableCacheStats stats() const;
+
+private:
+    struct Change final
+    {
+        OptionalString  value       {};     ///< std::nullopt removes the row.
+        s64             expiresAt   {};     ///< Wall clock seconds, zero never expires.
+        u32             attempts    {};     ///< Failed writes so far.
+    };
+
+    using Batch = std::vector<std::pair<const std::string*, Change*>>;
+
+    __tegra_no_discard static std::string keyOf(const std::string& key, bool eternal);
+    bool prepare();
+    bool enqueue(std::string name, Change change);
+    __tegra_no_discard std::size_t write(Batch& changes, std::size_t& failed);
+
+    TableCacheOptions                               m_options   {};
+    Scope<MemoryCache>                              m_near      {};
+    std::string                                     m_table     {};
+    std::atomic<bool>                               m_prepared  {false};
+    std::mutex                                      m_prepareMutex {};
+    mutable std::mutex                              m_mutex     {};
+    std::condition_variable_any                     m_signal    {};
+    std::unordered_map<std::string, Change>         m_pending   {};     ///< Latest queued change of every key.
+    std::unordered_map<std::string, Change>         m_inflight  {};     ///< Changes of the running flush, readable until they are written.
+    std::mutex                                      m_flushMutex {};    ///< One flush at a time.
+    std::atomic<u64>                                m_flushes   {};
+    std::atomic<u64>                                m_statements {};
+    std::atomic<u64>                                m_rows      {};
+    std::atomic<u64>                                m_failures  {};
+    std::atomic<u64>                                m_dropped   {};
+    std::atomic<u64>                                m_swept     {};
+    std::jthread                                    m_worker    {};
+
+    TEGRA_DISABLE_COPY(TableCache)
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_CACHE_TABLE_HPP
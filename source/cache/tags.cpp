@@ -0,0 +1,182 @@
+//! Tegra's Cache Tags.
+#ifdef __has_include
+# if __has_include("tags.hpp")
+#   include "tags.hpp"
+#else
+#   error "Tegra's cache tags was not found!"
+# endif
+#endif
+
+//! Tegra's Cache Manager.
+#ifdef __has_include
+# if __has_include("manager.hpp")
+#   include "manager.hpp"
+#else
+#   error "Tegra's cache manager was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+void TagIndex::configure(const VectorString& generational)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_generational = generational;
+}
+
+bool TagIndex::isGenerational(const std::string& tag)
+{
+    return std::any_of(m_generational.begin(), m_generational.end(), [&tag](const auto& prefix) { return tag.starts_with(prefix); });
+}
+
+std::string TagIndex::resolve(const std::string& key, const VectorString& tags)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    std::string res = key + "|" + TO_TEGRA_STRING(m_epoch);
+    for(const auto& tag : tags) {
+        if(!isGenerational(tag)) continue;
+        auto it = m_generations.find(tag);
+        res += "|" + tag + "=" + TO_TEGRA_STRING(it == m_generations.end() ? __tegra_zero : it->second);
+    }
+    return res;
+}
+
+void TagIndex::attach(const std::string& key, const VectorString& tags)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        if(m_tags.contains(key)) {
+            return;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    VectorString indexed{};
+    for(const auto& tag : tags) {
+        if(!isGenerational(tag)) indexed.push_back(tag);
+    }
+    if(indexed.empty() || m_tags.contains(key)) {
+        return;
+    }
+    if(m_tags.size() >= maxKeys.load(std::memory_order_relaxed)) {
+        //! Every indexed key carries the old epoch, so none of them is read again.
+        ++m_epoch;
+        m_entries.clear();
+        m_tags.clear();
+        m_invalidated.clear();
+    }
+    for(const auto& tag : indexed) {
+        m_entries[tag].insert(key);
+    }
+    m_tags.emplace(key, std::move(indexed));
+}
+
+void TagIndex::detach(const std::string& key)
+{
+    auto it = m_tags.find(key);
+    if(it == m_tags.end()) {
+        return;
+    }
+    for(const auto& tag : it->second) {
+        if(auto entry = m_entries.find(tag); entry != m_entries.end()) {
+            entry->second.erase(key);
+            if(entry->second.empty()) m_entries.erase(entry);
+        }
+    }
+    m_tags.erase(it);
+}
+
+bool TagIndex::invalidatedSince(const VectorString& tags, u64 sequence)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for(const auto& tag : tags) {
+        if(auto it = m_invalidated.find(tag); it != m_invalidated.end() && it->second > sequence) {
+            return true;
+        }
+    }
+    return false;
+}
+
+OptionalString TagIndex::getOrCompute(const std::string& key, u32 ttl, const VectorString& tags, const Abstracts::CacheLoader& loader)
+{
+    const auto resolved = resolve(key, tags);
+    if(shared.load(std::memory_order_relaxed)) {
+        const auto bound = sharedTtl.load(std::memory_order_relaxed);
+        ttl = ttl == __tegra_zero ? bound : std::min(ttl, bound);
+    }
+    //! The check runs inside the loader, so a background refresh that read the data before an invalidation does not store it either.
+    const Abstracts::CacheLoader checked = [tags, loader]() -> OptionalString {
+        const auto attempts = std::max(1u, maxReloads.load(std::memory_order_relaxed));
+        for(u32 i = 0; i < attempts; ++i) {
+            const auto before = m_sequence.load(std::memory_order_acquire);
+            auto value = loader();
+            if(!value.has_value() || !invalidatedSince(tags, before)) {
+                return value;
+            }
+        }
+        return std::nullopt;
+    };
+    const auto before = m_sequence.load(std::memory_order_acquire);
+    auto& cache = CacheManager::instance();
+    auto value = cache.getOrCompute(resolved, ttl, checked);
+    attach(resolved, tags);
+    //! An invalidation between the check and the store, or before attach, would miss the key; it is deleted here instead.
+    if(invalidatedSince(tags, before)) {
+        cache.deleteCache(resolved, false);
+    }
+    return value;
+}
+
+std::size_t TagIndex::invalidateTag(const std::string& tag)
+{
+    m_invalidations.fetch_add(1, std::memory_order_relaxed);
+    VectorString keys{};
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_invalidated[tag] = m_sequence.fetch_add(1, std::memory_order_acq_rel) + 1;
+        if(isGenerational(tag)) {
+            ++m_generations[tag];
+            return __tegra_zero;
+        }
+        auto it = m_entries.find(tag);
+        if(it == m_entries.end()) {
+            return __tegra_zero;
+        }
+        keys.assign(it->second.begin(), it->second.end());
+        for(const auto& key : keys) {
+            detach(key);
+        }
+    }
+    //! The cache is called outside the lock; a backend may take its time.
+    auto& cache = CacheManager::instance();
+    for(const auto& key : keys) {
+        cache.deleteCache(key, false);
+    }
+    m_purged.fetch_add(keys.size(), std::memory_order_relaxed);
+    return keys.size();
+}
+
+void TagIndex::invalidateAll()
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_sequence.fetch_add(1, std::memory_order_acq_rel);
+    ++m_epoch;
+    m_entries.clear();
+    m_tags.clear();
+    m_invalidated.clear();
+}
+
+TagIndexStats TagIndex::stats()
+{
+    TagIndexStats res{};
+    res.invalidations   = m_invalidations.load(std::memory_order_relaxed);
+    res.purged          = m_purged.load(std::memory_order_relaxed);
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    res.keys            = m_tags.size();
+    res.tags            = m_entries.size();
+    res.epoch           = m_epoch;
+    return res;
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,116 @@
+/*!
+ * @file        tags.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Dependency tags of the cached entries.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_CACHE_TAGS_HPP
+#define TEGRA_CACHE_TAGS_HPP
+
+//! Tegra's Abstract Cache.
+#ifdef __has_include
+# if __has_include("abstracts/cache.hpp")
+#   include "abstracts/cache.hpp"
+#else
+#   error "Tegra's cache was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Cache)
+
+/*!
+ * @brief The TagIndexStats struct holds the counters of the tag index.
+ */
+struct TagIndexStats final
+{
+    u64 keys            {};     ///< Indexed entries.
+    u64 tags            {};     ///< Indexed tags.
+    u64 invalidations   {};     ///< Calls of invalidateTag.
+    u64 purged          {};     ///< Entries deleted by invalidateTag.
+    u64 epoch           {};     ///< Number of times every tagged entry was dropped at once.
+};
+
+/*!
+ * @brief The TagIndex class records which cached entries depend on which tags, e.g. "table:teg_menu_l", "lang:fa_IR" or "page:42".
+ * Tags are either indexed or generational:
+ * - an indexed tag keeps the set of its entries, and invalidating it deletes exactly those entries;
+ * - a generational tag only has a counter that is part of the key of its entries, so invalidating it is a single increment
+ *   and the old entries are never read again; they leave the cache by ttl or eviction.
+ * Use generational tags for tags shared by huge sets, like a language. When the index outgrows maxKeys, the epoch, which is part of every
+ * tagged key, is increased and the index starts over, so memory stays bounded without missing an invalidation.
+ * The index lives in the process; with a shared backend, other processes only see the invalidations made through the database writes they run,
+ * so there an entry lives at most sharedTtl seconds.
+ */
+class __tegra_export TagIndex final
+{
+public:
+    /*!
+     * @brief configure function sets the prefixes of the generational tags.
+     * @param generational prefixes, e.g. "lang:".
+     */
+    static void configure(const VectorString& generational);
+
+    /*!
+     * @brief getOrCompute function reads or builds an entry of the application cache that depends on the tags.
+     * A load that overlaps an invalidation of one of the tags is discarded and run again, in the foreground and in a background refresh alike,
+     * so an entry never outlives its data; after maxReloads overlapping loads nothing is stored and nullopt is returned.
+     */
+    static OptionalString getOrCompute(const std::string& key, u32 ttl, const VectorString& tags, const Abstracts::CacheLoader& loader);
+
+    /*!
+     * @brief resolve function returns the cache key of an entry, with the epoch and the generations of its generational tags.
+     */
+    __tegra_no_discard static std::string resolve(const std::string& key, const VectorString& tags);
+
+    /*!
+     * @brief attach function records the indexed tags of a resolved key.
+     */
+    static void attach(const std::string& key, const VectorString& tags);
+
+    /*!
+     * @brief invalidateTag function drops every entry that depends on the tag.
+     * @returns number of deleted entries; zero for a generational tag.
+     */
+    static std::size_t invalidateTag(const std::string& tag);
+
+    /*!
+     * @brief invalidateAll function drops every tagged entry in O(1).
+     */
+    static void invalidateAll();
+
+    /*!
+     * @brief stats function returns the counters.
+     */
+    __tegra_no_discard static TagIndexStats stats();
+
+    __tegra_inline_static std::atomic<u64>  maxKeys     { 100000 }; ///< Indexed entries after which the index starts over.
+    __tegra_inline_static std::atomic<u32>  maxReloads  { 3 };      ///< Loads of an entry that may overlap an invalidation before it is given up.
+    __tegra_inline_static std::atomic<u32>  sharedTtl   { 60 };     ///< Upper bound of the ttl when the backend is shared with other processes.
+    __tegra_inline_static std::atomic<bool> shared      { false };  ///< Backend is shared with other processes, set by CacheManager::configure.
+
+private:
+    __tegra_no_discard static bool isGenerational(const std::string& tag);
+    __tegra_no_discard static bool invalidatedSince(const VectorString& tags, u64 sequence);
+    static void detach(const std::string& key);
+
+    __tegra_inline_static std::shared_mutex                                         m_mutex         {};
+    __tegra_inline_static VectorString                                              m_generational  {};
+    __tegra_inline_static std::unordered_map<std::string, std::unordered_set<std::string>> m_entries {};    ///< Tag to resolved keys.
+    __tegra_inline_static std::unordered_map<std::string, VectorString>             m_tags          {};     ///< Resolved key to indexed tags.
+    __tegra_inline_static std::unordered_map<std::string, u64>                      m_generations   {};
+    __tegra_inline_static std::unordered_map<std::string, u64>                      m_invalidated   {};     ///< Sequence of the last invalidation of a tag.
+    __tegra_inline_static u64                                                       m_epoch         {};
+    __tegra_inline_static std::atomic<u64>                                          m_sequence      {};
+    __tegra_inline_static std::atomic<u64>                                          m_invalidations {};
+    __tegra_inline_static std::atomic<u64>                                          m_purged        {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_CACHE_TAGS_HPP
@@ -274,6 +274,8 @@ object = nullptr;                   \
 #define FLTCOMBINER(v1, v2) v1[v2].asFloat()
 
 #define APPLICATION_DB_RUN(rdbms, dbHost, dbPort, dbName, dbUsername, dbPassword) AppFramework::application().createDbClient(FROM_TEGRA_STRING(rdbms), dbHost, dbPort, dbName, dbUsername, dbPassword).run();
+#define APPLICATION_DB_CREATE(rdbms, dbHost, dbPort, dbName, dbUsername, dbPassword, dbConnections, dbClient) AppFramework::application().createDbClient(FROM_TEGRA_STRING(rdbms), dbHost, dbPort, dbName, dbUsername, dbPassword, dbConnections, __tegra_null_str, dbClient);
+#define APPLICATION_SQLITE_CREATE(dbFile, dbConnections, dbClient) AppFramework::application().createDbClient("sqlite3", __tegra_null_str, 0, __tegra_null_str, __tegra_null_str, __tegra_null_str, dbConnections, dbFile, dbClient);
 
 //! EXPORTS & EXTRA
 #if defined(__WINNT) || defined(__WINNT__) || defined(WIN32) || \
@@ -16,6 +16,24 @@
 # endif
 #endif
 
+//! Tegra's Timing.
+#ifdef __has_include
+# if __has_include(<timing>)
+#   include <timing>
+#else
+#   error "Tegra's timing was not found!"
+# endif
+#endif
+
+//! Tegra's Metrics.
+#ifdef __has_include
+# if __has_include(<metrics>)
+#   include <metrics>
+#else
+#   error "Tegra's metrics was not found!"
+# endif
+#endif
+
 TEGRA_USING_NAMESPACE Tegra;
 TEGRA_USING_NAMESPACE Tegra::System;
 TEGRA_USING_NAMESPACE Tegra::eLogger;
@@ -88,6 +106,9 @@ void Application::start()
 
     // Configuration before use
     config.init(SectionType::SystemCore);
+    RequestTimer::serverTimingHeader = Configuration::GET["server_timing"].asBool();
+    //! The responses are counted from the first one on, whether a database is configured or not.
+    Metrics::configure(Configuration::GET["metrics"]);
     {   // Set from cmake config.hpp.in
         semanticVersion.Major = PROJECT_VERSION_MAJOR;
         semanticVersion.Minor = PROJECT_VERSION_MINOR;
@@ -173,8 +173,8 @@ void Configuration::init(const SectionType sectionType)
     }
     if (reader.good())
     {
-        if(file.is_open())
-            reader.parse(file, GET);
+        if(file.is_open() && reader.parse(file, GET))
+            revision.fetch_add(1, std::memory_order_release);
     }
     file.close();
 }
@@ -79,6 +79,11 @@ public:
      */
     inline static Json::Value GET;
 
+    /*!
+     * \brief revision is increased every time GET is loaded, so caches derived from it know when to rebuild.
+     */
+    inline static std::atomic<u64> revision {};
+
     /*!
      * \brief Checks and initializations are required from the abstract class before configuration.
      */
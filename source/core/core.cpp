@@ -22,6 +22,15 @@
 # endif
 #endif
 
+//! Tegra's Database Registry.
+#ifdef __has_include
+# if __has_include("database/registry.hpp")
+#   include "database/registry.hpp"
+#else
+#   error "Tegra's database registry was not found!"
+# endif
+#endif
+
 TEGRA_USING_NAMESPACE Tegra;
 TEGRA_USING_NAMESPACE Tegra::System;
 TEGRA_USING_NAMESPACE Tegra::View;
@@ -108,27 +117,27 @@ EngineInterface::EngineInterface()
     }
 
          //! Page Init Time
-         //! ToDo...
+         //! Set by setPageMetrics.
     {
-        if(!isset(m_bootParameter->pageInitTime)) { m_bootParameter->pageInitTime = 1316615272; }
+        if(!isset(m_bootParameter->pageInitTime)) { m_bootParameter->pageInitTime = 0; }
     }
 
          //! Page Size
-         //! ToDo...
+         //! Set by setPageMetrics.
     {
         if(!isset(m_bootParameter->pageSize)) { m_bootParameter->pageSize = 0; }
     }
 
          //! Page Speed
-         //! ToDo...
+         //! Set by setPageMetrics.
     {
         if(!isset(m_bootParameter->pageSpeed)) { m_bootParameter->pageSpeed = 0; }
     }
 
          //! Init Time
-         //! ToDo...
+         //! Set by setPageMetrics.
     {
-        if(!isset(m_bootParameter->initTime)) { m_bootParameter->initTime = 1316615272; }
+        if(!isset(m_bootParameter->initTime)) { m_bootParameter->initTime = 0; }
     }
 
          //! User Mode
@@ -196,7 +205,8 @@ EngineInterface::~EngineInterface()
 
 std::time_t EngineInterface::getInitTime()
 {
-
+    std::lock_guard<std::mutex> lock(m_pageMutex);
+    return m_lastPage.initTime;
 }
 
 Optional<std::string> EngineInterface::getSaveState()
@@ -210,25 +220,20 @@ Optional<std::string> EngineInterface::getSaveState()
 
 Optional<u32> EngineInterface::getPageSize()
 {
-    if (isset(m_bootParameter->pageSize)) {
-        return m_bootParameter->pageSize;
-    } else {
-        return std::nullopt;
-    }
+    std::lock_guard<std::mutex> lock(m_pageMutex);
+    return m_lastPage.pageSize;
 }
 
 std::time_t EngineInterface::getPageInitTime()
 {
-  //ToDo...
+    std::lock_guard<std::mutex> lock(m_pageMutex);
+    return m_lastPage.pageInitTime;
 }
 
 Optional<u32> EngineInterface::getPageSpeed()
 {
-    if (isset(m_bootParameter->pageSpeed)) {
-        return m_bootParameter->pageSpeed;
-    } else {
-        return std::nullopt;
-    }
+    std::lock_guard<std::mutex> lock(m_pageMutex);
+    return m_lastPage.pageSpeed;
 }
 
 Optional<s32> EngineInterface::getStateIndex()
@@ -299,6 +304,18 @@ Optional<SystemStatus> EngineInterface::getSystemStatus()
     }
 }
 
+void EngineInterface::setPageMetrics(std::time_t initTime, std::time_t pageInitTime, u32 pageSize)
+{
+    const auto pageSpeed = initTime > 0 ? static_cast<u32>(static_cast<u64>(pageSize) * 1000 / static_cast<u64>(initTime)) : pageSize;
+    m_bootParameter->initTime       = initTime;
+    m_bootParameter->pageInitTime   = pageInitTime;
+    m_bootParameter->pageSize       = pageSize;
+    m_bootParameter->pageSpeed      = pageSpeed;
+    //! The engine of a request dies with it, so the readers get the values from here.
+    std::lock_guard<std::mutex> lock(m_pageMutex);
+    m_lastPage = PageMetrics { initTime, pageInitTime, pageSize, pageSpeed };
+}
+
 Engine::Engine()
 {
     ///< New instances.
@@ -547,8 +564,13 @@ std::string Engine::mixedTablePrefix(const std::string& p, const std::string& t)
 
 std::string Engine::table(std::string_view tableName, TableType tableType)
 {
+    //! Known tables are prefixed once per configuration snapshot.
+    const auto known = Database::TableRegistry::name(tableName);
+    if(!known.empty()) {
+        return FROM_TEGRA_STRING(known);
+    }
     std::string res{};
-    res = FROM_TEGRA_STRING(mixedTablePrefix(tablePrefix(), tableName.data()));
+    res = FROM_TEGRA_STRING(mixedTablePrefix(tablePrefix(), FROM_TEGRA_STRING(tableName)));
     if(!isset(res)) {
         if(System::DeveloperMode::IsEnable)
             Log("Table not found!", LoggerType::Warning);
@@ -558,28 +580,21 @@ std::string Engine::table(std::string_view tableName, TableType tableType)
 
 VectorString Engine::tableFilter(const std::vector<std::string>& tables, TableType tableType)
 {
-    std::string valueStruct = Configuration::GET["table_value_struct"].asString();
     std::vector<std::string> res{};
+    //! The role of every known table is precomputed, so filtering is a single pass.
+    const auto valueTable = [](const std::string& t) { return Database::TableRegistry::role(t) == Database::TableType::ValueSturct; };
     switch (tableType)
     {
     case TableType::MixedStruct:
         res=tables;
         break;
     case TableType::KeyStruct:
-        res=tables;
-        for(const auto& t : tables) {
-            if(t.ends_with(valueStruct)) {
-                res.erase(std::remove(res.begin(), res.end(), t), res.end());
-            }
-        }
+        res.reserve(tables.size());
+        std::copy_if(tables.begin(), tables.end(), std::back_inserter(res), [&valueTable](const std::string& t) { return !valueTable(t); });
         break;
     case TableType::ValueSturct:
-        res=tables;
-        for(const auto& t : tables) {
-            if(!t.ends_with(valueStruct)) {
-                res.erase(std::remove(res.begin(), res.end(), t), res.end());
-            }
-        }
+        res.reserve(tables.size());
+        std::copy_if(tables.begin(), tables.end(), std::back_inserter(res), valueTable);
         break;
     default:
         res=tables;
@@ -327,11 +327,11 @@ private:
 struct __tegra_export BootParameter __tegra_final
 {
     bool                       fastBoot       {};      ///<This property is set to true when the system is booted with the highest possible state.
-    std::time_t                initTime       {};      ///<The time spent on execution.
+    std::time_t                initTime       {};      ///<The time spent on execution, in microseconds.
     Optional<std::string>      saveState      {};      ///<The system save state applied during a save operation after execution or completion of the operation..
     Optional<u32>              pageSize       {};      ///<The size of the requested page.
-    std::time_t                pageInitTime   {};      ///<The loading time of the requested page.
-    Optional<u32>              pageSpeed      {};      ///<The loading speed of the requested page.
+    std::time_t                pageInitTime   {};      ///<The loading time of the requested page before its view is rendered, in microseconds.
+    Optional<u32>              pageSpeed      {};      ///<The loading speed of the requested page, in bytes per millisecond.
     Optional<s32>              stateIndex     {};      ///<The state of index for any page.
     Optional<HostType>         hostType       {};      ///<This attribute specifies the type of site hosting. for example: Linux
     Optional<StorageType>      storageType    {};      ///<This attribute specifies the type of storage to use.
@@ -342,6 +342,17 @@ struct __tegra_export BootParameter __tegra_final
     Optional<SystemStatus>     systemStatus   {};      ///<This attribute specifies the state the system is in.
 };
 
+/*!
+ * @brief The PageMetrics struct holds the metrics of a page that has been sent.
+ */
+struct __tegra_export PageMetrics __tegra_final
+{
+    std::time_t                initTime       {};      ///<The time spent on the request, in microseconds.
+    std::time_t                pageInitTime   {};      ///<The time spent before the view was rendered, in microseconds.
+    u32                        pageSize       {};      ///<The size of the response body in bytes.
+    u32                        pageSpeed      {};      ///<The speed of the page, in bytes per millisecond.
+};
+
 class __tegra_export EngineInterface
 {
 public:
@@ -362,7 +373,7 @@ public:
     virtual bool                            getFastBoot         () final;
 
     /*!
-     * @brief Getting current system init time duration.
+     * @brief Getting the time spent on the last page sent, in microseconds.
      * @returns returns as time.
      */
     virtual std::time_t                     getInitTime         () final;
@@ -374,19 +385,19 @@ public:
     virtual Optional<std::string>      getSaveState        () final;
 
     /*!
-     * @brief Getting current loaded page size.
+     * @brief Getting the size of the last page sent, in bytes.
      * @returns returns as unsigned int 32 for page size.
      */
     virtual Optional<u32>              getPageSize         () final;
 
     /*!
-     * @brief Getting current system current page init time duration.
+     * @brief Getting the time spent on the last page sent before its view was rendered, in microseconds.
      * @returns returns as time.
      */
     virtual std::time_t                     getPageInitTime     () final;
 
     /*!
-     * @brief Getting current page speed load.
+     * @brief Getting the speed of the last page sent, in bytes per millisecond.
      * @returns returns as counter of page speed.
      */
     virtual Optional<u32>              getPageSpeed        () final;
@@ -433,10 +444,20 @@ public:
      */
     virtual Optional<SystemStatus>     getSystemStatus     () final;
 
+    /*!
+     * @brief Setting the metrics of the requested page; they are shared by every engine, as each request builds its own.
+     * @param initTime is the time spent on the request, in microseconds.
+     * @param pageInitTime is the time spent before the view was rendered, in microseconds.
+     * @param pageSize is the size of the response body in bytes.
+     */
+    virtual void                       setPageMetrics      (std::time_t initTime, std::time_t pageInitTime, u32 pageSize) final;
 
 private:
     BootParameter* m_bootParameter{nullptr};
     bool m_status{false};
+
+    __tegra_inline_static std::mutex    m_pageMutex {};
+    __tegra_inline_static PageMetrics   m_lastPage  {};     ///< Metrics of the last page sent.
 };
 
 /*!
@@ -7,6 +7,51 @@
 # endif
 #endif
 
+//! Tegra's Database Registry.
+#ifdef __has_include
+# if __has_include("database/registry.hpp")
+#   include "database/registry.hpp"
+#else
+#   error "Tegra's database registry was not found!"
+# endif
+#endif
+
+//! Tegra's Database Migration.
+#ifdef __has_include
+# if __has_include("database/migration.hpp")
+#   include "database/migration.hpp"
+#else
+#   error "Tegra's database migration was not found!"
+# endif
+#endif
+
+//! Tegra's Database Projection.
+#ifdef __has_include
+# if __has_include("database/projection.hpp")
+#   include "database/projection.hpp"
+#else
+#   error "Tegra's database projection was not found!"
+# endif
+#endif
+
+//! Tegra's Cache.
+#ifdef __has_include
+# if __has_include(<cache>)
+#   include <cache>
+#else
+#   error "Tegra's cache was not found!"
+# endif
+#endif
+
+//! Tegra's Tracing.
+#ifdef __has_include
+# if __has_include(<tracing>)
+#   include <tracing>
+#else
+#   error "Tegra's tracing was not found!"
+# endif
+#endif
+
 TEGRA_USING_NAMESPACE Tegra;
 TEGRA_USING_NAMESPACE Tegra::Abstracts;
 TEGRA_USING_NAMESPACE Tegra::System;
@@ -162,6 +207,12 @@ void Manager::createDatabase()
             }
         }
         break;
+    case Database::DriverTypes::SQLite:
+        //! The database file is created when the connection opens it.
+        if(DeveloperMode::IsEnable) {
+            eLogger::Log("SQLite database is created on connect.", eLogger::LoggerType::Info);
+        }
+        break;
     default:
         if(DeveloperMode::IsEnable) {
             eLogger::Log("Please select a database driver!", eLogger::LoggerType::Critical);
@@ -209,6 +260,11 @@ void Manager::removeDatabase()
                 }
             });
         break;
+    case Database::DriverTypes::SQLite:
+        if(DeveloperMode::IsEnable) {
+            eLogger::Log("SQLite database must be removed as a file while the system is stopped.", eLogger::LoggerType::Warning);
+        }
+        break;
     default:
         if(DeveloperMode::IsEnable) {
             eLogger::Log("Please select a database driver!", eLogger::LoggerType::Critical);
@@ -280,6 +336,22 @@ void Manager::backupDatabase(Database::DriverTypes type, const DatabaseList& db,
             }
         }
         break;
+    case Database::DriverTypes::SQLite:
+        //! VACUUM INTO writes a consistent, compacted copy while readers and the writer keep running.
+        try
+        {
+            clientPtr->execSqlSync("VACUUM INTO '" + p + "backup.sqlite3'");
+            if(DeveloperMode::IsEnable) {
+                eLogger::Log("Database backup has been created!", eLogger::LoggerType::Success);
+            }
+        }
+        catch (const SqlException& e)
+        {
+            if(DeveloperMode::IsEnable) {
+                eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+            }
+        }
+        break;
     default:
         if(DeveloperMode::IsEnable) {
             eLogger::Log("Please select a database driver!", eLogger::LoggerType::Critical);
@@ -345,6 +417,8 @@ void Manager::createTables(Database::DriverTypes type)
         }
         break;
     case Database::DriverTypes::PostgreSQL:
+    case Database::DriverTypes::SQLite:
+        //! SQLite tables are created from the PostgreSQL definitions.
         for(const auto& t : tableNames) {
             tables.push_back(FROM_TEGRA_STRING(DROP_TABLE_IF_EXIST) + __tegra_space + engine.table(t, System::TableType::MixedStruct));
         }
@@ -355,12 +429,16 @@ void Manager::createTables(Database::DriverTypes type)
                         for(const auto& t : engine.tableFilter(tableNames, System::TableType::KeyStruct)) {
                             if(d["name"]==t)
                                 tables.push_back(CREATE_TABLE __tegra_space + engine.table(t, System::TableType::KeyStruct) +
-                                                 __tegra_space + FROM_TEGRA_STRING(d["content"].asString()));
+                                                 __tegra_space + (type == Database::DriverTypes::SQLite
+                                                                   ? SqlHelper::toSqliteDialect(d["content"].asString())
+                                                                   : FROM_TEGRA_STRING(d["content"].asString())));
                         }
                         for(const auto& t : engine.tableFilter(tableNames, System::TableType::ValueSturct)) {
                             if(d["name"]==t)
                                 tables.push_back(CREATE_TABLE __tegra_space + engine.table(t, System::TableType::ValueSturct) +
-                                                 __tegra_space + FROM_TEGRA_STRING(d["content"].asString()));
+                                                 __tegra_space + (type == Database::DriverTypes::SQLite
+                                                                   ? SqlHelper::toSqliteDialect(d["content"].asString())
+                                                                   : FROM_TEGRA_STRING(d["content"].asString())));
                         }
                     }
                 }
@@ -417,6 +495,7 @@ void Manager::removeTables(Database::DriverTypes type)
         }
         break;
     case Database::DriverTypes::PostgreSQL:
+    case Database::DriverTypes::SQLite:
         for(const auto& t : tableNames) {
             tables.push_back(FROM_TEGRA_STRING(DROP_TABLE_IF_EXIST) + __tegra_space + t);
         }
@@ -438,6 +517,7 @@ void Manager::removeTables(Database::DriverTypes type)
         break;
     }
 
+    Query::invalidateAll();
 }
 
 void Manager::insertTables(Database::DriverTypes type)
@@ -505,8 +585,9 @@ void Manager::insertTables(Database::DriverTypes type)
         }
         break;
     case Database::DriverTypes::PostgreSQL:
+    case Database::DriverTypes::SQLite:
         //Reset All tables first.
-        resetAllTables(DriverTypes::PostgreSQL);
+        resetAllTables(type);
         filterContent.insert(std::pair<std::string, std::string>("{{system_name}}", TEGRA_TRANSLATOR("global", "name")));
         filterContent.insert(std::pair<std::string, std::string>("{{website_address}}", CONFIG::OFFICIAL_EMAIL));
         filterContent.insert(std::pair<std::string, std::string>("{{email}}", CONFIG::OFFICIAL_EMAIL));
@@ -517,12 +598,16 @@ void Manager::insertTables(Database::DriverTypes type)
                         for(const auto& t : engine.tableFilter(tableNames, System::TableType::KeyStruct)) {
                             if(d["name"]==t)
                                 tables.push_back(INSERT __tegra_space INTO __tegra_space + engine.table(t, System::TableType::KeyStruct)
-                                                 + __tegra_space + FROM_TEGRA_STRING(d["content"].asString()));
+                                                 + __tegra_space + (type == Database::DriverTypes::SQLite
+                                                                    ? SqlHelper::toSqliteDialect(d["content"].asString())
+                                                                    : FROM_TEGRA_STRING(d["content"].asString())));
                         }
                         for(const auto& t : engine.tableFilter(tableNames, System::TableType::ValueSturct)) {
                             if(d["name"]==t) {
                                 tables.push_back(INSERT __tegra_space INTO __tegra_space + engine.table(t, System::TableType::ValueSturct)
-                                                 + __tegra_space + FROM_TEGRA_STRING(engine.fullReplacer(FROM_TEGRA_STRING(d["content"].asString()), filterContent)));
+                                                 + __tegra_space + (type == Database::DriverTypes::SQLite
+                                                                    ? SqlHelper::toSqliteDialect(engine.fullReplacer(FROM_TEGRA_STRING(d["content"].asString()), filterContent))
+                                                                    : FROM_TEGRA_STRING(engine.fullReplacer(FROM_TEGRA_STRING(d["content"].asString()), filterContent))));
                             }
                         }
                     }
@@ -551,6 +636,7 @@ void Manager::insertTables(Database::DriverTypes type)
         }
         break;
     }
+    Query::invalidateAll();
 }
 
 void Manager::resetAllTables(Database::DriverTypes type)
@@ -605,12 +691,31 @@ void Manager::resetAllTables(Database::DriverTypes type)
             }
         }
         break;
+    case Database::DriverTypes::SQLite:
+        //! SQLite has no TRUNCATE; an unqualified DELETE uses its truncate optimization.
+        for(const auto& t : tableNames) {
+            tables.push_back(FROM_TEGRA_STRING(DELETE) + __tegra_space + FROM + __tegra_space + engine->table(t, System::TableType::MixedStruct));
+        }
+        try
+        {
+            for(const auto& i : tables) {
+                clientPtr->execSqlSync(i);
+            }
+        }
+        catch (const SqlException& e)
+        {
+            if(DeveloperMode::IsEnable) {
+                eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+            }
+        }
+        break;
     default:
         if(DeveloperMode::IsEnable) {
             eLogger::Log("Please select a database driver!", eLogger::LoggerType::Critical);
         }
         break;
     }
+    Query::invalidateAll();
 }
 
 void Manager::resetTable(Database::DriverTypes type, const std::string& tableName)
@@ -653,12 +758,25 @@ void Manager::resetTable(Database::DriverTypes type, const std::string& tableNam
             }
         }
         break;
+    case Database::DriverTypes::SQLite:
+        try
+        {
+            clientPtr->execSqlSync(FROM_TEGRA_STRING(DELETE) + __tegra_space + FROM + __tegra_space + engine->table(tableName, System::TableType::MixedStruct));
+        }
+        catch (const SqlException& e)
+        {
+            if(DeveloperMode::IsEnable) {
+                eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+            }
+        }
+        break;
     default:
         if(DeveloperMode::IsEnable) {
             eLogger::Log("Please select a database driver!", eLogger::LoggerType::Critical);
         }
         break;
     }
+    Query::invalidate(engine->table(tableName, System::TableType::MixedStruct));
 }
 
 const TableList& Manager::tables() const
@@ -692,9 +810,16 @@ unsigned int SqlHelper::lastInsertedId(const std::string& table) noexcept
             }
         }
         if(config->currentRdbms() == Database::TEGRA_RDBMS::MySQL) {
-            for (auto &row : clientPtr->execSqlSync("select max(id)+1 from "+engine->tablePrefix()+table+";"))
+            for (auto &row : clientPtr->execSqlSync("select max(id)+1 as setval from "+engine->tablePrefix()+table+";"))
             {
-                maxIndex = row["setval"].as<int>() == __tegra_zero ? 1 : row["setval"].as<int>();
+                maxIndex = row["setval"].isNull() ? 1 : row["setval"].as<int>();
+            }
+        }
+        //! Like the other drivers, the next id of the table; last_insert_rowid() would be the last id of any table.
+        if(config->currentRdbms() == Database::TEGRA_RDBMS::SQLite) {
+            for (auto &row : clientPtr->execSqlSync("select max(id)+1 as setval from "+engine->tablePrefix()+table+";"))
+            {
+                maxIndex = row["setval"].isNull() ? 1 : row["setval"].as<int>();
             }
         }
     }
@@ -705,14 +830,49 @@ unsigned int SqlHelper::lastInsertedId(const std::string& table) noexcept
     return maxIndex;
 }
 
+std::string SqlHelper::toSqliteDialect(const std::string& statement)
+{
+    //! A single INTEGER primary key becomes the rowid, which already generates ids.
+    static const std::vector<std::pair<std::regex, std::string>> rules {
+        { std::regex(R"(\s+GENERATED\s+(BY\s+DEFAULT|ALWAYS)\s+AS\s+IDENTITY)", std::regex::icase), "" },
+        { std::regex(R"(\bTIMESTAMPTZ\b)", std::regex::icase), "TIMESTAMP" },
+        { std::regex(R"(\bNOW\(\))", std::regex::icase), "CURRENT_TIMESTAMP" },
+        { std::regex(R"(\bBIGSERIAL\b|\bSERIAL\b)", std::regex::icase), "INTEGER" },
+        { std::regex(R"(::[A-Za-z_]+(\(\d+\))?)"), "" }
+    };
+    //! Only the text outside string literals is rewritten; a quote inside a literal is doubled.
+    std::string res{}, text{};
+    auto flush = [&]() {
+        for(const auto& [rule, replacement] : rules) {
+            text = std::regex_replace(text, rule, replacement);
+        }
+        res += text;
+        text.clear();
+    };
+    for(std::size_t i = 0; i < statement.size(); ++i) {
+        if(statement[i] != '\'') {
+            text += statement[i];
+            continue;
+        }
+        flush();
+        auto end = i + 1;
+        while(end < statement.size()) {
+            if(statement[end] == '\'' && (end + 1 == statement.size() || statement[end + 1] != '\'')) break;
+            end += statement[end] == '\'' ? 2 : 1;
+        }
+        res += statement.substr(i, end - i + 1);
+        i = end;
+    }
+    flush();
+    return res;
+}
+
 
 void Connection::connect()
 {
     std::string rdbms{}, dbName{}, dbUsername{}, dbPassword{}, dbCharset{}, dbHost{}, tablePrefix{};
 
-    std::vector<std::string> driverType{};
-
-    unsigned int dbPort{__tegra_zero};
+    unsigned int dbPort{__tegra_zero}, dbConnections{1};
 
     Scope<Configuration> config(new Configuration(ConfigType::File));
 
@@ -720,26 +880,101 @@ void Connection::connect()
 
     auto getConf = Configuration::GET["database"];
 
-    for(const auto& c : getConf) {
+    const auto statistics = Configuration::GET["query_statistics"];
+    if(!statistics.isNull()) {
+        QueryStatistics::enabled        = BOOLCOMBINER(statistics, "enabled");
+        QueryStatistics::slowThreshold  = statistics["slow_threshold_ms"].asUInt();
+        QueryStatistics::sampleRate     = DBLCOMBINER(statistics, "sample_rate");
+    }
 
-        if(isset(BOOLCOMBINER(c,"status"))) {
+    const auto projection = Configuration::GET["projection"];
+    if(!projection.isNull()) {
+        const auto mode = STRCOMBINER(projection, "mode");
+        VectorString tables{};
+        for(const auto& t : projection["tables"]) tables.push_back(t.asString());
+        Projection::configure(mode == "view" ? ProjectionMode::MaterializedView : mode == "memory" ? ProjectionMode::Memory : ProjectionMode::Off,
+                              tables, STRCOMBINER(Configuration::GET, "table_prefix"),
+                              Configuration::GET.isMember("table_value_struct") ? STRCOMBINER(Configuration::GET, "table_value_struct")
+                                                                               : FROM_TEGRA_STRING(CONFIG::SYSTEM_TABLES_VALUE_STRUCT));
+    }
 
-            driverType.push_back(STRCOMBINER(c, "rdbms"));
+    const auto tenancy = Configuration::GET["tenancy"];
+    if(!tenancy.isNull()) {
+        TenantRouter::maxPools          = tenancy["max_pools"].asUInt();
+        TenantRouter::maxConnections    = tenancy["max_connections"].asUInt();
+        TenantRouter::idleTimeout       = tenancy["idle_timeout"].asUInt();
+    }
+    TenantRouter::load();
 
-            for(const auto& d : driverType) {
-                rdbms = d;
-            }
+    Cache::CacheManager::configure(Configuration::GET["cache"]);
+
+    Tracer::configure(Configuration::GET["tracing"]);
 
+    //! The primary is the last enabled entry without a replica role, like before.
+    for(const auto& c : getConf) {
+        if(isset(BOOLCOMBINER(c,"status")) && STRCOMBINER(c, "role") != "replica") {
+            rdbms           =   STRCOMBINER(c, "rdbms");
             dbHost          =   STRCOMBINER(c, "host");
             dbName          =   STRCOMBINER(c, "name");
             dbUsername      =   STRCOMBINER(c, "username");
             dbPassword      =   STRCOMBINER(c, "password");
             dbPort          =   INTCOMBINER(c, "port");
+            dbConnections   =   c.isMember("connections") ? std::max(1, INTCOMBINER(c, "connections")) : 1;
         }
     }
 
     try {
-        APPLICATION_DB_RUN(rdbms, dbHost, dbPort, dbName, dbUsername, dbPassword);
+        Router::clear();
+        const auto driver = rdbms == TEGRA_RDBMS::MySQL ? DriverTypes::MySQL
+                            : rdbms == TEGRA_RDBMS::SQLite ? DriverTypes::SQLite : DriverTypes::PostgreSQL;
+        TableRegistry::setDriver(driver);
+        //! Pending migrations of system-database.json are applied before the first request, by one node at a time.
+        AppFramework::application().registerBeginningAdvice([driver]() {
+            Migrator migrator(driver);
+            migrator.load();
+            Configuration(ConfigType::File).init(SectionType::SystemCore);
+            if(!migrator.migrate()) {
+                eLogger::Log("Database Error: pending migrations could not be applied!", eLogger::LoggerType::Critical);
+            }
+        });
+        if(rdbms == TEGRA_RDBMS::SQLite) {
+            //! The name is the database file; writes are serialized on one connection and reads use a pool over the same WAL file.
+            APPLICATION_SQLITE_CREATE(dbName, 1, "default");
+            APPLICATION_SQLITE_CREATE(dbName, dbConnections, "sqlite_reader");
+            Router::registerNode({ .name = "default", .rdbms = rdbms, .role = ClientRole::Primary });
+            Router::registerNode({ .name = "sqlite_reader", .rdbms = rdbms, .role = ClientRole::Replica });
+            AppFramework::application().registerBeginningAdvice([]() {
+                for(const auto& pragma : { "PRAGMA journal_mode=WAL", "PRAGMA synchronous=NORMAL" }) {
+                    Router::writer()->execSqlAsync(pragma, [](const SqlResult&) {}, [](const SqlException& e) {
+                        eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+                    });
+                }
+            });
+            AppFramework::application().run();
+            return;
+        }
+        APPLICATION_DB_CREATE(rdbms, dbHost, dbPort, dbName, dbUsername, dbPassword, dbConnections, "default");
+        Router::registerNode({ .name = "default", .rdbms = rdbms, .role = ClientRole::Primary });
+
+        //! Replicas must share the driver of the primary; each one gets its own named client.
+        u32 index{__tegra_zero};
+        for(const auto& c : getConf) {
+            if(!isset(BOOLCOMBINER(c,"status")) || STRCOMBINER(c, "role") != "replica" || STRCOMBINER(c, "rdbms") != rdbms)
+                continue;
+            ++index;
+            ClientNode node;
+            node.name   = c.isMember("client") ? STRCOMBINER(c, "client") : "replica_" + TO_TEGRA_STRING(index);
+            node.rdbms  = rdbms;
+            node.role   = ClientRole::Replica;
+            node.maxLag = c.isMember("max_lag") ? c["max_lag"].asUInt() : __tegra_zero;
+            node.weight = c.isMember("weight") ? c["weight"].asUInt() : 1;
+            const auto conn = c.isMember("connections") ? std::max(1, INTCOMBINER(c, "connections")) : 1;
+            APPLICATION_DB_CREATE(rdbms, STRCOMBINER(c, "host"), INTCOMBINER(c, "port"), STRCOMBINER(c, "name"),
+                                  STRCOMBINER(c, "username"), STRCOMBINER(c, "password"), conn, node.name);
+            Router::registerNode(node);
+        }
+
+        AppFramework::application().run();
     }
     catch (const SqlException& e)
     {
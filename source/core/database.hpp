@@ -89,7 +89,7 @@ struct Constants final
     };
 
     __tegra_inline_static_const VectorString drivers {
-        "mysql", "postgresql"
+        "mysql", "postgresql", "sqlite3"
     };
 
 };
@@ -120,6 +120,7 @@ enum class TableType : u8
 struct TEGRA_RDBMS final {
     static constexpr std::string_view   MySQL       = "mysql";
     static constexpr std::string_view   PostgreSQL  = "postgresql";
+    static constexpr std::string_view   SQLite      = "sqlite3";
 
 };
 
@@ -169,6 +170,19 @@ struct TEGRA_TABLES final
     static constexpr std::string_view   REVIEW                  = "review";
     static constexpr std::string_view   TRANSACTION             = "transaction";
     static constexpr std::string_view   LIKES                   = "likes";
+    static constexpr std::string_view   SCHEMA_MIGRATIONS       = "schema_migrations";
+
+    //! Every table above, for the table registry.
+    static constexpr std::array<std::string_view, 44> ALL {
+        CONFIG, CONFIG_L, APIKEY, RESOURCE, RESOURCE_L, DRAFTS,
+        TEMPLATES, TEMPLATES_L, SERVICES, SERVICES_L, GROUPS, GROUPS_L,
+        MENU, MENU_L, MODULES, MODULES_L, PLUGINS, PLUGINS_L,
+        TAGS, TAGS_L, CONFIG_GROUPS, CONFIG_GROUPS_L, TASKS, CACHE,
+        PROVINCES, CITIES, GLOBALIZATION, TRANSLATION, MEMBERS, MEMBERS_ACCOUNT,
+        MEMBERS_CONTACT, MEMBERS_EXTRA, MEMBERS_JOB, MEMBERS_KNOWN_DEVICES, MEMBERS_SOCIAL, MEMBERS_SESSION,
+        MEMBERS_VERIFICATION, QUESTIONS, ANSWERS, RATING, REVIEW, TRANSACTION,
+        LIKES, SCHEMA_MIGRATIONS
+    };
 };
 
 /*!
@@ -179,7 +193,8 @@ enum class DriverTypes : u8
     Default     = 0x0, ///<The driver that is selected by default.
     MySQL       = 0x1, ///<Mysql driver.
     PostgreSQL  = 0x2, ///<Postgresql driver.
-    Unknown     = 0x3  ///<If no driver is detected!
+    Unknown     = 0x3, ///<If no driver is detected!
+    SQLite      = 0x4  ///<Embedded SQLite driver (WAL mode, single node).
 };
 
 using DatabaseList = std::vector<std::string>;
@@ -350,6 +365,13 @@ private:
 struct SqlHelper final
 {
     unsigned int lastInsertedId(const std::string& table) __tegra_noexcept;
+
+    /*!
+     * \brief toSqliteDialect function will translate a PostgreSQL table definition or insert into SQLite.
+     * \param statement is a PostgreSQL statement.
+     * \returns SQLite statement.
+     */
+    __tegra_no_discard static std::string toSqliteDialect(const std::string& statement);
 };
 
 #define IsConnected Connection::isConnected()
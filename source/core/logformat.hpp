@@ -0,0 +1,140 @@
+/*!
+ * @file        logformat.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Binary format of the structured log files.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_LOGFORMAT_HPP
+#define TEGRA_LOGFORMAT_HPP
+
+//! Tegra's Common.
+#ifdef __has_include
+# if __has_include(<common>)
+#   include <common>
+#else
+#   error "Tegra's common was not found!"
+# endif
+#endif
+
+/*!
+ * A file starts with MAGIC and is followed by frames; every file can be decoded on its own.
+ * String frame:  [u8 Frame::String][u32 id][u32 size][bytes]
+ * Record frame:  [u8 Frame::Record][u64 nanoseconds since epoch][u64 thread][u32 counter][u32 line]
+ *                [u32 function id][u32 file id][u32 format id][u8 type][u32 size][payload]
+ * Strings are the static texts (function, file and format) and are written once per file, before their first use.
+ * With format id zero the payload is the message; otherwise it is the arguments of the format, each one an Argument tag and its value.
+ * Numbers are in the byte order of the writer.
+ */
+TEGRA_NAMESPACE_BEGIN(Tegra::eLogger::Binary)
+
+constexpr std::string_view MAGIC { "TGLOG01\n" };
+
+constexpr std::string_view EXTENSION { ".tlog" };
+
+__tegra_enum_class Frame : u8
+{
+    String      =   0x1,    ///<A static text and its id.
+    Record      =   0x2     ///<A log record.
+};
+
+__tegra_enum_class Argument : u8
+{
+    Signed      =   0x1,    ///<s64.
+    Unsigned    =   0x2,    ///<u64.
+    Float       =   0x3,    ///<double.
+    Boolean     =   0x4,    ///<u8.
+    String      =   0x5     ///<u32 size and the bytes.
+};
+
+template <typename T>
+void put(std::string& out, const T value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+inline void put(std::string& out, std::string_view value)
+{
+    put<u32>(out, static_cast<u32>(value.size()));
+    out.append(value);
+}
+
+/*!
+ * @brief get function reads a value and advances the cursor; false when the data is too short.
+ */
+template <typename T>
+bool get(std::string_view& in, T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    if(in.size() < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, in.data(), sizeof(T));
+    in.remove_prefix(sizeof(T));
+    return true;
+}
+
+inline bool get(std::string_view& in, std::string_view& value)
+{
+    u32 size {};
+    if(!get(in, size) || in.size() < size) {
+        return false;
+    }
+    value = in.substr(0, size);
+    in.remove_prefix(size);
+    return true;
+}
+
+#ifdef USE_FMT
+/*!
+ * @brief encode function appends an argument of a format.
+ */
+template <typename T>
+void encode(std::string& out, const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        put(out, Argument::Boolean);
+        put<u8>(out, value ? 1 : 0);
+    } else if constexpr (std::is_same_v<T, char>) {
+        put(out, Argument::String);
+        put(out, std::string_view(&value, 1));
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        put(out, Argument::Signed);
+        put<s64>(out, static_cast<s64>(value));
+    } else if constexpr (std::is_integral_v<T>) {
+        put(out, Argument::Unsigned);
+        put<u64>(out, static_cast<u64>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        put(out, Argument::Float);
+        put<double>(out, static_cast<double>(value));
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        put(out, Argument::String);
+        put(out, std::string_view(value));
+    } else {
+        //! Anything else is kept as its text.
+        put(out, Argument::String);
+        put(out, std::string_view(fmt::format("{}", value)));
+    }
+}
+#endif
+
+/*!
+ * @brief typeName function returns the name of a logger type.
+ */
+constexpr std::string_view typeName(const int type) __tegra_noexcept
+{
+    constexpr std::array<std::string_view, 9> names {
+        "Default", "Info", "Warning", "Critical", "Failed", "Success", "Done", "Paused", "InProgress"
+    };
+    return type >= 0 && type < static_cast<int>(names.size()) ? names[static_cast<std::size_t>(type)] : names.front();
+}
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_LOGFORMAT_HPP
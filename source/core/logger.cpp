@@ -20,229 +20,611 @@ TEGRA_USING_NAMESPACE Tegra::Terminal;
 
 TEGRA_NAMESPACE_BEGIN(Tegra::eLogger)
 
-Logger::~Logger()
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+//! Slots of the queue; a power of two.
+constexpr u64 QUEUE_CAPACITY = 8192;
+
+//! Records written by the sink in one go.
+constexpr std::size_t BATCH_SIZE = 256;
+
+//! Bytes of a message kept in the record itself; longer ones are copied to the heap.
+constexpr std::size_t INLINE_MESSAGE = 160;
+
+//! Longest wait of the idle sink before it looks at the queue again.
+constexpr std::chrono::milliseconds IDLE_WAIT { 50 };
+
+//! Period of the sink's look at the suppressed records.
+constexpr std::chrono::seconds SUMMARY_CHECK { 1 };
+
+s64 steadyNanoseconds() __tegra_noexcept
 {
-    std::ostream& streamInStyle  = std::cout;
-    streamInStyle << NativeTerminal::Reset << __tegra_newline;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 
-void Logger::echo(const unsigned int    counter,
-                  const time_t          occurTime,
-                  const unsigned int    line,
-                  std::string_view      function,
-                  std::string_view      file,
-                  std::string_view      message,
-                  const int             type)
+using Style = std::ostream& (*)(std::ostream&);
+
+/*!
+ * \brief The Record struct is a fixed-size log record; everything is formatted on the sink thread.
+ */
+struct Record final
+{
+    std::thread::id                     threadId    {};
+    time_t                              occurTime   {};
+    u64                                 nanoseconds {};     ///< Only taken in the DataMining mode.
+    std::string_view                    function    {};
+    std::string_view                    file        {};
+    std::string_view                    format      {};     ///< Static format of a structured record; the text holds its arguments.
+    u32                                 counter     {};
+    u32                                 line        {};
+    u32                                 size        {};
+    int                                 type        {};
+    Mode                                mode        { Mode::User };
+    LogeState                           state       { LogeState::Normal };
+    std::array<char, INLINE_MESSAGE>    text        {};
+    std::string                         spill       {};
+
+    std::string_view message() const __tegra_noexcept
+    {
+        return size <= INLINE_MESSAGE ? std::string_view(text.data(), size) : std::string_view(spill);
+    }
+};
+
+/*!
+ * \brief The Ring class is a bounded lock-free queue of records (Vyukov's MPMC queue).
+ * Producers may also pop, which is how the oldest record is dropped when the queue is full.
+ */
+class Ring final
 {
-    std::thread::id threadId = std::this_thread::get_id();
-    std::stringstream strThreadId;
-    strThreadId << threadId;
+public:
+    Ring() : m_slots(std::make_unique<Slot[]>(QUEUE_CAPACITY))
+    {
+        for(u64 i = 0; i < QUEUE_CAPACITY; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool tryPush(Record& record)
+    {
+        auto pos = m_head.load(std::memory_order_relaxed);
+        for(;;) {
+            auto& slot = m_slots[pos & (QUEUE_CAPACITY - 1)];
+            const auto diff = static_cast<s64>(slot.sequence.load(std::memory_order_acquire)) - static_cast<s64>(pos);
+            if(diff == 0) {
+                if(m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.record = std::move(record);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if(diff < 0) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
 
-    std::mutex           mutex_l;
-    std::string          typeStr         = __tegra_null_str;
-    std::ostream&        streamInStyleV1   = std::cout; //Buffered version.
-    std::ostream&        streamInStyleV2   = std::clog; //UnBuffered version.
-    std::string          beginStyle      = __tegra_null_str;
-    std::string          endStyle        = __tegra_null_str;
+    bool tryPop(Record& record)
+    {
+        auto pos = m_tail.load(std::memory_order_relaxed);
+        for(;;) {
+            auto& slot = m_slots[pos & (QUEUE_CAPACITY - 1)];
+            const auto diff = static_cast<s64>(slot.sequence.load(std::memory_order_acquire)) - static_cast<s64>(pos + 1);
+            if(diff == 0) {
+                if(m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    record = std::move(slot.record);
+                    slot.sequence.store(pos + QUEUE_CAPACITY, std::memory_order_release);
+                    return true;
+                }
+            } else if(diff < 0) {
+                return false;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
 
+    bool empty() const __tegra_noexcept
+    {
+        return m_tail.load(std::memory_order_acquire) >= m_head.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Slot final
+    {
+        std::atomic<u64>    sequence    {};
+        Record              record      {};
+    };
+
+    std::unique_ptr<Slot[]>         m_slots;
+    alignas(64) std::atomic<u64>    m_head  {};
+    alignas(64) std::atomic<u64>    m_tail  {};
+};
+
+Style styleOf(const int type) __tegra_noexcept
+{
     switch (type) {
-    case LoggerType::Default:
-        typeStr     =  "Default";
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::Default;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::Default;
-            break;
+    case LoggerType::Info:          return NativeTerminal::Info;
+    case LoggerType::Warning:       return NativeTerminal::Warning;
+    case LoggerType::Critical:      return NativeTerminal::Critical;
+    case LoggerType::Failed:        return NativeTerminal::Error;
+    case LoggerType::Success:       return NativeTerminal::Success;
+    case LoggerType::Done:          return NativeTerminal::Done;
+    case LoggerType::Paused:        return NativeTerminal::Paused;
+    case LoggerType::InProgress:    return NativeTerminal::InProgress;
+    default:                        return NativeTerminal::Default;
+    }
+}
+
+/*!
+ * \brief The BinaryFile class writes the records of the DataMining mode to rotating files; see logformat.hpp.
+ * The newest file is "tegra.tlog", the older ones "tegra.1.tlog" to "tegra.N.tlog"; a restart shifts them as well, so the last run is kept.
+ */
+class BinaryFile final
+{
+public:
+    void write(const Record& record)
+    {
+        if(!m_stream.is_open() && !open()) {
+            return;
         }
-        beginStyle  = "\033[0;90m";
-        endStyle    = "\033[0m";
-        break;
-    case LoggerType::Info:
-        typeStr =  "Info" ;
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::Info;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::Info;
-            break;
+        m_buffer.clear();
+        const auto function = define(record.function);
+        const auto file     = define(record.file);
+        const auto format   = record.format.empty() ? __tegra_zero : define(record.format);
+        Binary::put(m_buffer, Binary::Frame::Record);
+        Binary::put<u64>(m_buffer, record.nanoseconds);
+        Binary::put<u64>(m_buffer, static_cast<u64>(std::hash<std::thread::id>{}(record.threadId)));
+        Binary::put<u32>(m_buffer, record.counter);
+        Binary::put<u32>(m_buffer, record.line);
+        Binary::put<u32>(m_buffer, function);
+        Binary::put<u32>(m_buffer, file);
+        Binary::put<u32>(m_buffer, format);
+        Binary::put<u8>(m_buffer, static_cast<u8>(record.type));
+        Binary::put(m_buffer, record.message());
+        m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_written += m_buffer.size();
+        if(m_written >= Logger::LogFileSize) {
+            rotate();
         }
-        beginStyle  = "\033[0;37m";
-        endStyle    = "\033[0m";
-        break;
-    case LoggerType::Warning:
-        typeStr =  "Warning" ;
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::Warning;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::Warning;
-            break;
+    }
+
+    void flush()
+    {
+        if(m_stream.is_open()) m_stream.flush();
+    }
+
+private:
+    bool open()
+    {
+        //! A directory that can not be created is not retried for every record.
+        if(m_failed) {
+            return false;
         }
-        beginStyle  = "\033[0;33m";
-        endStyle    = "\033[0m";
-        break;
-    case LoggerType::Critical:
-        typeStr =  "Critical" ;
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::Critical;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::Critical;
-            break;
+        m_directory = Logger::LogDirectory;
+        std::error_code error{};
+        std::filesystem::create_directories(m_directory, error);
+        //! The file of a previous run or a full one is shifted to "tegra.1.tlog"; a file without records is overwritten.
+        const auto size = std::filesystem::file_size(pathOf(__tegra_zero), error);
+        if(!error && size > Binary::MAGIC.size()) {
+            shift();
         }
-        beginStyle  = "\033[0;31m";
-        endStyle    = "\033[0m";
-        break;
-    case LoggerType::Failed:
-        typeStr =  "Failed" ;
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::Error;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::Error;
-            break;
+        m_stream.open(pathOf(__tegra_zero), std::ios::binary | std::ios::trunc);
+        if(!m_stream.is_open()) {
+            m_failed = true;
+            std::clog << "Log file [" << pathOf(__tegra_zero).string() << "] can not be opened!" << __tegra_newline;
+            return false;
         }
-        beginStyle  = "\033[1;91m";
-        endStyle    = "\033[0m";
-        break;
-    case LoggerType::Success:
-        typeStr =  "Success" ;
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::Success;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::Success;
-            break;
+        m_stream.write(Binary::MAGIC.data(), static_cast<std::streamsize>(Binary::MAGIC.size()));
+        m_written = Binary::MAGIC.size();
+        m_strings.clear();
+        return true;
+    }
+
+    void rotate()
+    {
+        m_stream.close();
+        open();
+    }
+
+    void shift() const
+    {
+        std::error_code error{};
+        const auto files = std::max<u32>(Logger::LogFiles, 1);
+        std::filesystem::remove(pathOf(files), error);
+        for(auto i = files; i > 1; --i) {
+            std::filesystem::rename(pathOf(i - 1), pathOf(i), error);
         }
-        beginStyle  = "\033[0;32m";
-        endStyle    = "\033[0m";
-        break;
-    case LoggerType::Done:
-        typeStr =  "Done" ;
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::Done;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::Done;
-            break;
+        std::filesystem::rename(pathOf(__tegra_zero), pathOf(1), error);
+    }
+
+    std::filesystem::path pathOf(const u32 index) const
+    {
+        return m_directory / ("tegra" + (index == __tegra_zero ? __tegra_null_str : "." + TO_TEGRA_STRING(index)) + FROM_TEGRA_STRING(Binary::EXTENSION));
+    }
+
+    //! Static texts are keyed by their address and written once per file.
+    u32 define(std::string_view text)
+    {
+        auto [it, inserted] = m_strings.try_emplace(text.data(), static_cast<u32>(m_strings.size() + 1));
+        if(inserted) {
+            Binary::put(m_buffer, Binary::Frame::String);
+            Binary::put<u32>(m_buffer, it->second);
+            Binary::put(m_buffer, text);
         }
-        beginStyle  = "\033[1;92m";
-        endStyle    = "\033[0m";
-        break;
-    case LoggerType::Paused:
-        typeStr =  "Paused" ;
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::Paused;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::Paused;
-            break;
+        return it->second;
+    }
+
+    std::ofstream                               m_stream    {};
+    std::filesystem::path                       m_directory {};
+    std::unordered_map<const void*, u32>        m_strings   {};
+    std::string                                 m_buffer    {};
+    u64                                         m_written   {};
+    bool                                        m_failed    { false };
+};
+
+/*!
+ * \brief The Sink class owns the queue and the thread that writes it to the terminal.
+ */
+class Sink final
+{
+public:
+    Sink()
+    {
+        m_running.store(true, std::memory_order_release);
+        m_thread = std::thread([this] { run(); });
+        std::atexit([] { Logger::shutdown(); });
+    }
+
+    static Sink& get()
+    {
+        //! Never destroyed, so the objects destroyed at exit can still log.
+        static auto* sink = new Sink();
+        return *sink;
+    }
+
+    void push(Record& record)
+    {
+        if(!m_running.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(m_writeMutex);
+            write(&record, 1);
+            return;
         }
-        beginStyle  = "\033[1;96m";
-        endStyle    = "\033[0m";
-        break;
-    case LoggerType::InProgress:
-        typeStr =  "InProgress" ;
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1       << NativeTerminal::InProgress;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2       << NativeTerminal::InProgress;
-            break;
+        while(!m_ring.tryPush(record)) {
+            Record oldest{};
+            if(m_ring.tryPop(oldest)) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        //! A missed wake-up only delays the record by IDLE_WAIT.
+        if(m_sleeping.load(std::memory_order_acquire)) {
+            m_signal.notify_one();
+        }
+        //! The sink stopped while the record was queued.
+        if(!m_running.load(std::memory_order_acquire)) {
+            drain();
         }
-        beginStyle  = "\033[1;93m";
-        endStyle    = "\033[0m";
-        break;
     }
 
-    if(LoggerModel == Mode::User) {
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1 << " => Log Id : [" << counter
-                            << "] : ["  << typeStr << "] "
-                            << message << " { DateTime: "
-                            << std::put_time(localtime(&occurTime), "%Y/%m/%d %H:%M:%S") << " }"
-                            << NativeTerminal::Reset << __tegra_newline;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2   << " => Log Id : [" << counter
-                            << "] : ["  << typeStr << "] "
-                            << message << " { DateTime: "
-                            << std::put_time(localtime(&occurTime), "%Y/%m/%d %H:%M:%S") << " }"
-                            << NativeTerminal::Reset << __tegra_newline;
-            break;
+    void flush()
+    {
+        while(m_running.load(std::memory_order_acquire) && (!m_ring.empty() || m_writing.load(std::memory_order_acquire))) {
+            m_signal.notify_one();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
         }
+    }
 
-        std::lock_guard<std::mutex> lock(mutex_l);
+    void shutdown()
+    {
+        std::lock_guard<std::mutex> lock(m_stopMutex);
+        if(!m_running.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        m_signal.notify_one();
+        if(m_thread.joinable()) {
+            m_thread.join();
+        }
+        //! Records pushed while the thread was stopping.
+        drain();
+        summarize(true);
+    }
 
-    } else if(LoggerModel == Mode::Developer) {
+    //! Called once per site, on its first suppressed record; a module loaded again finds the summary of its call by file and line.
+    LogSummary& enroll(std::string_view function, std::string_view file, const uint line)
+    {
+        std::lock_guard<std::mutex> lock(m_sitesMutex);
+        auto& summary = m_sites[FROM_TEGRA_STRING(file) + ":" + TO_TEGRA_STRING(line)];
+        if(summary == nullptr) {
+            summary = std::make_unique<LogSummary>();
+            summary->function   = function;
+            summary->file       = file;
+            summary->line       = line;
+        }
+        return *summary;
+    }
 
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1 << " => Log Id : [" << counter  << "]"
-                            << "[ Line : "  << line << "] "
-                            << "[ Function : "  << function << "] "
-                            << "[ Thread Id : "  << strThreadId.str() << "] "
-                            << "[ File : "  << file << "] "
-                            << "] : ["    << typeStr << "] "
-                            << message    << " { DateTime: "
-                            << std::put_time(localtime(&occurTime), "%Y/%m/%d %H:%M:%S") << " }"
-                            << NativeTerminal::Reset << __tegra_newline;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2 << " => Log Id : [" << counter  << "]"
-                            << "[ Line : "  << line << "] "
-                            << "[ Function : "  << function << "] "
-                            << "[ Thread Id : "  << strThreadId.str() << "] "
-                            << "[ File : "  << file << "] "
-                            << "] : ["    << typeStr << "] "
-                            << message    << " { DateTime: "
-                            << std::put_time(localtime(&occurTime), "%Y/%m/%d %H:%M:%S") << " }"
-                            << NativeTerminal::Reset << __tegra_newline;
-            break;
+    u64 dropped() const __tegra_noexcept
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run()
+    {
+        auto lastSummary = std::chrono::steady_clock::now();
+        while(m_running.load(std::memory_order_acquire)) {
+            if(const auto now = std::chrono::steady_clock::now(); now - lastSummary >= SUMMARY_CHECK) {
+                summarize(false);
+                lastSummary = now;
+            }
+            if(drain() != __tegra_zero) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleeping.store(true, std::memory_order_release);
+            if(m_ring.empty() && m_running.load(std::memory_order_acquire)) {
+                m_signal.wait_for(lock, IDLE_WAIT);
+            }
+            m_sleeping.store(false, std::memory_order_release);
+        }
+    }
+
+    /*!
+     * \brief summarize function writes "Suppressed N identical messages" for the sites whose first dropped record is old enough.
+     * @param all writes every pending summary, as at shutdown.
+     */
+    void summarize(const bool all)
+    {
+        const auto now = steadyNanoseconds();
+        const auto interval = static_cast<s64>(Logger::SummaryInterval.load(std::memory_order_relaxed)) * 1000000000;
+        std::vector<Record> summaries{};
+        {
+            std::lock_guard<std::mutex> lock(m_sitesMutex);
+            for(const auto& [name, site] : m_sites) {
+                if(site->suppressed.load(std::memory_order_relaxed) == __tegra_zero) continue;
+                const auto elapsed = now - site->since.load(std::memory_order_relaxed);
+                if(!all && elapsed < interval) continue;
+                const auto count = site->suppressed.exchange(0, std::memory_order_relaxed);
+                if(count == __tegra_zero) continue;
+                const auto message = "Suppressed " + TO_TEGRA_STRING(count) + " identical messages in the last "
+                                     + TO_TEGRA_STRING(std::max<s64>(elapsed / 1000000000, 1)) + "s.";
+                auto& record = summaries.emplace_back();
+                record.threadId     = std::this_thread::get_id();
+                record.occurTime    = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+                record.nanoseconds  = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+                record.function     = site->function;
+                record.file         = site->file;
+                record.line         = site->line;
+                record.type         = LoggerType::Warning;
+                record.mode         = Logger::LoggerModel;
+                record.state        = Logger::LoggerState;
+                record.size         = static_cast<u32>(message.size());
+                if(message.size() <= INLINE_MESSAGE) {
+                    std::memcpy(record.text.data(), message.data(), message.size());
+                } else {
+                    record.spill = message;
+                }
+            }
+        }
+        if(!summaries.empty()) {
+            std::lock_guard<std::mutex> lock(m_writeMutex);
+            write(summaries.data(), summaries.size());
+        }
+    }
+
+    //! Callers are serialized by the write mutex, as they share the batch.
+    std::size_t drain()
+    {
+        std::size_t total = __tegra_zero;
+        for(;;) {
+            std::size_t count = __tegra_zero;
+            {
+                std::lock_guard<std::mutex> lock(m_writeMutex);
+                m_writing.store(true, std::memory_order_release);
+                while(count < BATCH_SIZE && m_ring.tryPop(m_batch[count])) {
+                    ++count;
+                }
+                if(count != __tegra_zero) {
+                    write(m_batch.data(), count);
+                }
+                m_writing.store(false, std::memory_order_release);
+            }
+            total += count;
+            if(count < BATCH_SIZE) {
+                return total;
+            }
         }
+    }
 
-        std::lock_guard<std::mutex> lock(mutex_l);
+    /*!
+     * \brief write function formats the records and writes them with one call per stream.
+     * The Windows console takes its colors as calls, so there the records go to the stream one by one.
+     */
+    void write(Record* records, const std::size_t count)
+    {
+        std::ostringstream out{};
+        std::ostringstream err{};
+        for(std::size_t i = 0; i < count; ++i) {
+            auto& record = records[i];
+            if(record.mode == Mode::DataMining) {
+                m_binary.write(record);
+                record.spill.clear();
+                record.spill.shrink_to_fit();
+                continue;
+            }
+#ifdef PLATFORM_WINDOWS
+            std::ostream& stream = record.state == LogeState::Normal ? std::cout : std::clog;
+#else
+            std::ostream& stream = record.state == LogeState::Normal ? static_cast<std::ostream&>(out) : static_cast<std::ostream&>(err);
+#endif
+            format(stream, record);
+            record.spill.clear();
+            record.spill.shrink_to_fit();
+        }
+        if(const auto data = out.view(); !data.empty()) {
+            std::cout.write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+        if(const auto data = err.view(); !data.empty()) {
+            std::clog.write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+        std::cout.flush();
+        m_binary.flush();
+    }
 
-    } else if(LoggerModel == Mode::DataMining) {
+    void format(std::ostream& stream, const Record& record)
+    {
+        stream << styleOf(record.type) << " => Log Id : [" << record.counter << "]";
+        if(record.mode != Mode::User) {
+            stream << "[ Line : "       << record.line      << "] "
+                   << "[ Function : "   << record.function  << "] "
+                   << "[ Thread Id : "  << record.threadId  << "] "
+                   << "[ File : "       << record.file      << "] "
+                   << "]";
+        }
+        stream << " : ["  << Binary::typeName(record.type) << "] "
+               << record.message() << " { DateTime: " << dateTime(record.occurTime) << " }"
+               << NativeTerminal::Reset << __tegra_newline;
+    }
 
-        switch (LoggerState) {
-        case LogeState::Normal:
-            streamInStyleV1 << " => Log Id : [" << counter  << "]"
-                            << "[ Line : "  << line << "] "
-                            << "[ Function : "  << function << "] "
-                            << "[ Thread Id : "  << strThreadId.str() << "] "
-                            << "[ File : "  << file << "] "
-                            << "] : ["    << typeStr << "] "
-                            << message    << " { DateTime: "
-                            << std::put_time(localtime(&occurTime), "%Y/%m/%d %H:%M:%S") << " }"
-                            << NativeTerminal::Reset << __tegra_newline;
-            break;
-        case LogeState::ForceToError:
-            streamInStyleV2 << " => Log Id : [" << counter  << "]"
-                            << "[ Line : "  << line << "] "
-                            << "[ Function : "  << function << "] "
-                            << "[ Thread Id : "  << strThreadId.str() << "] "
-                            << "[ File : "  << file << "] "
-                            << "] : ["    << typeStr << "] "
-                            << message    << " { DateTime: "
-                            << std::put_time(localtime(&occurTime), "%Y/%m/%d %H:%M:%S") << " }"
-                            << NativeTerminal::Reset << __tegra_newline;
+    //! Records of the same second share the formatted time.
+    std::string_view dateTime(const time_t occurTime)
+    {
+        if(occurTime != m_lastTime || m_lastDateTime.empty()) {
+            std::tm local{};
+#ifdef PLATFORM_WINDOWS
+            localtime_s(&local, &occurTime);
+#else
+            localtime_r(&occurTime, &local);
+#endif
+            std::array<char, 32> buffer{};
+            const auto size = std::strftime(buffer.data(), buffer.size(), "%Y/%m/%d %H:%M:%S", &local);
+            m_lastDateTime.assign(buffer.data(), size);
+            m_lastTime = occurTime;
+        }
+        return m_lastDateTime;
+    }
+
+    Ring                                m_ring          {};
+    BinaryFile                          m_binary        {};
+    std::array<Record, BATCH_SIZE>      m_batch         {};
+    std::thread                         m_thread        {};
+    std::mutex                          m_stopMutex     {};
+    std::mutex                          m_sleepMutex    {};
+    std::mutex                          m_writeMutex    {};
+    std::condition_variable             m_signal        {};
+    std::atomic<bool>                   m_running       { false };
+    std::atomic<bool>                   m_sleeping      { false };
+    std::atomic<bool>                   m_writing       { false };
+    std::atomic<u64>                    m_dropped       {};
+    std::mutex                          m_sitesMutex    {};
+    std::unordered_map<std::string, std::unique_ptr<LogSummary>> m_sites {};  ///< Summaries by file:line, never removed.
+    time_t                              m_lastTime      {};
+    std::string                         m_lastDateTime  {};
+};
+
+TEGRA_NAMESPACE_END
+
+Logger::~Logger()
+{
+    std::ostream& streamInStyle  = std::cout;
+    streamInStyle << NativeTerminal::Reset << __tegra_newline;
+}
+
+void Logger::echo(const unsigned int    counter,
+                  const time_t          occurTime,
+                  const unsigned int    line,
+                  std::string_view      function,
+                  std::string_view      file,
+                  std::string_view      message,
+                  const int             type)
+{
+    echoArguments(counter, occurTime, line, function, file, __tegra_null_str, message, type);
+}
+
+void Logger::echoArguments(const unsigned int    counter,
+                           const time_t          occurTime,
+                           const unsigned int    line,
+                           std::string_view      function,
+                           std::string_view      file,
+                           std::string_view      format,
+                           std::string_view      arguments,
+                           const int             type)
+{
+    Record record{};
+    record.threadId     = std::this_thread::get_id();
+    record.occurTime    = occurTime;
+    record.function     = function;
+    record.file         = file;
+    record.format       = format;
+    record.counter      = counter;
+    record.line         = line;
+    record.size         = static_cast<u32>(arguments.size());
+    record.type         = type;
+    record.mode         = LoggerModel;
+    record.state        = LoggerState;
+    if(record.mode == Mode::DataMining) {
+        record.nanoseconds = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+    if(arguments.size() <= INLINE_MESSAGE) {
+        std::memcpy(record.text.data(), arguments.data(), arguments.size());
+    } else {
+        record.spill.assign(arguments);
+    }
+    Sink::get().push(record);
+}
+
+bool Logger::admit(LogSite& site, std::string_view function, std::string_view file, const uint line) __tegra_noexcept
+{
+    const auto rate = RateLimit.load(std::memory_order_relaxed);
+    if(rate == __tegra_zero) {
+        return true;
+    }
+    const s64 interval  = 1000000000 / rate;
+    const s64 tolerance = interval * std::max<s64>(RateBurst.load(std::memory_order_relaxed), 1);
+    const auto now = steadyNanoseconds();
+    auto arrival = site.arrival.load(std::memory_order_relaxed);
+    for(;;) {
+        const auto start = std::max(arrival, now);
+        if(start + interval - now > tolerance) {
             break;
         }
-        std::lock_guard<std::mutex> lock(mutex_l);
+        if(site.arrival.compare_exchange_weak(arrival, start + interval, std::memory_order_relaxed)) {
+            return true;
+        }
     }
+    auto* summary = site.summary.load(std::memory_order_acquire);
+    if(summary == nullptr) {
+        try {
+            summary = &Sink::get().enroll(function, file, line);
+            site.summary.store(summary, std::memory_order_release);
+        } catch (...) {
+            return false;
+        }
+    }
+    if(summary->suppressed.fetch_add(1, std::memory_order_relaxed) == __tegra_zero) {
+        summary->since.store(now, std::memory_order_relaxed);
+    }
+    return false;
 }
 
+void Logger::setLevel(const LogLevel level) __tegra_noexcept
+{
+    MinimumLevel.store(static_cast<u8>(level), std::memory_order_relaxed);
+}
+
+void Logger::flush()
+{
+    Sink::get().flush();
+}
+
+void Logger::shutdown()
+{
+    Sink::get().shutdown();
+}
+
+u64 Logger::dropped() __tegra_noexcept
+{
+    return Sink::get().dropped();
+}
 
 TEGRA_NAMESPACE_END
@@ -22,6 +22,15 @@
 # endif
 #endif
 
+//! Tegra's Log Format.
+#ifdef __has_include
+# if __has_include("logformat.hpp")
+#   include "logformat.hpp"
+#else
+#   error "Tegra's log format was not found!"
+# endif
+#endif
+
 TEGRA_NAMESPACE_BEGIN(Tegra::eLogger)
 
 /*!
@@ -44,7 +53,7 @@ __tegra_enum_class Mode : u8
 {
     User        =   0x0,    ///<Based on user log.
     Developer   =   0x1,    ///<Based on developer for debuging log.
-    DataMining  =   0x2     ///<Based on data log.
+    DataMining  =   0x2     ///<Based on data log; binary records go to the rotating files of LogDirectory.
 };
 
 __tegra_enum_class LogeState : u8
@@ -52,13 +61,69 @@ __tegra_enum_class LogeState : u8
     ForceToError, Normal
 };
 
-#define Log(message, type)                                                                  \
-Logger::echo(__tegra_compiler_counter,                                                      \
+/*!
+ * \brief The LogLevel enum orders the records by severity; every LoggerType has one.
+ */
+__tegra_enum_class LogLevel : u8
+{
+    Trace       =   0x0,    ///<Finest records.
+    Debug       =   0x1,    ///<Default messages.
+    Info        =   0x2,    ///<Info, success, done, paused and in progress messages.
+    Warning     =   0x3,    ///<Warning messages.
+    Error       =   0x4,    ///<Failed messages.
+    Critical    =   0x5,    ///<Critical messages.
+    Off         =   0x6     ///<Nothing is logged.
+};
+
+//! Records below this level are removed at compile time; see TEGRA_LOG_MIN_LEVEL in CMake.
+#ifndef TEGRA_LOG_MIN_LEVEL
+#define TEGRA_LOG_MIN_LEVEL 0
+#endif
+
+#define TEGRA_LOG_FIRST(first, ...) first
+
+/*!
+ * \brief The LogSummary struct counts the dropped records of a call; the sink owns it and keeps copies of the texts,
+ * so it stays valid after the module that holds the call is unloaded.
+ */
+struct LogSummary final
+{
+    std::atomic<u64>    suppressed  {};     ///< Records dropped since the last summary.
+    std::atomic<s64>    since       {};     ///< Time of the first of them.
+    std::string         function    {};
+    std::string         file        {};
+    uint                line        {};
+};
+
+/*!
+ * \brief The LogSite struct is the rate limit state of one Log call; every call holds its own.
+ */
+struct LogSite final
+{
+    std::atomic<s64>            arrival     {};             ///< Theoretical arrival time of the next record (GCRA), in nanoseconds.
+    std::atomic<LogSummary*>    summary     { nullptr };    ///< Set on the first dropped record.
+};
+
+/*!
+ * Log(message, type) or Log(type, "format {}", args...).
+ * The level is checked before any argument is evaluated, so the message of a disabled record is never built,
+ * and a record below TEGRA_LOG_MIN_LEVEL folds away with the whole call.
+ * Every call is rate limited on its own; the records over the limit are counted and summarized by the sink.
+ */
+#define Log(first, ...)                                                                     \
+Logger::enabled(std::is_enum_v<std::remove_cvref_t<decltype(first)>>                        \
+                ? ::Tegra::eLogger::Logger::levelOf(first)                                  \
+                : ::Tegra::eLogger::Logger::levelOf(TEGRA_LOG_FIRST(__VA_ARGS__)))          \
+&& ::Tegra::eLogger::Logger::admit([]() -> ::Tegra::eLogger::LogSite& {                     \
+       static ::Tegra::eLogger::LogSite site {};                                            \
+       return site;                                                                         \
+   }(), __tegra_compiler_function, __tegra_compiler_file, __tegra_compiler_line)            \
+&& (::Tegra::eLogger::Logger::echo(__tegra_compiler_counter,                                \
              std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()),        \
              __tegra_compiler_line,                                                         \
              __tegra_compiler_function,                                                     \
              __tegra_compiler_file,                                                         \
-             message, type)
+             first, __VA_ARGS__), true)
 
 class Logger;
 /*!
@@ -78,8 +143,28 @@ public:
 
     inline static LogeState LoggerState = LogeState::Normal;
 
+    inline static std::atomic<u8> MinimumLevel { static_cast<u8>(LogLevel::Trace) };
+
+    //! Records a second of one Log call may write; zero turns the limit off.
+    inline static std::atomic<u32> RateLimit { 10 };
+
+    //! Records one Log call may write at once before the rate applies.
+    inline static std::atomic<u32> RateBurst { 20 };
+
+    //! Seconds after the first dropped record of a call before its summary is written.
+    inline static std::atomic<u32> SummaryInterval { 10 };
+
+    //! Files of the DataMining mode; read when the first binary record is written.
+    inline static std::string LogDirectory = "server-log/";
+
+    inline static u64 LogFileSize = 64 * 1024 * 1024;
+
+    inline static u32 LogFiles = 8;
+
     /*!
-     * \brief echo function will prints all data inline of usage!
+     * \brief echo function queues the record for the sink thread, which formats and writes it.
+     * The caller never waits for the terminal; when the queue is full the oldest record is dropped.
+     * The function and file must outlive the record, as the literals given by the Log macro do.
      * \param counter as total called number.
      * \param occurTime shows the time of usage.
      * \param line shows the line of code.
@@ -97,6 +182,134 @@ public:
         std::string_view    message,
         const int           type);
 
+#ifdef USE_FMT
+    /*!
+     * \brief echo function formats the arguments and queues the record; the Log macro only calls it for an enabled level.
+     */
+    template <typename... Args>
+    static void echo(
+        const uint              counter,
+        const time_t            occurTime,
+        const uint              line,
+        std::string_view        function,
+        std::string_view        file,
+        const LoggerType        type,
+        fmt::format_string<Args...> format,
+        Args&&...               args)
+    {
+        if(LoggerModel == Mode::DataMining) {
+            //! The arguments are kept raw and formatted by tegra-logcat.
+            thread_local std::string arguments{};
+            arguments.clear();
+            (Binary::encode(arguments, args), ...);
+            const fmt::string_view text = format;
+            echoArguments(counter, occurTime, line, function, file, std::string_view(text.data(), text.size()), arguments, type);
+            return;
+        }
+        echo(counter, occurTime, line, function, file, fmt::format(format, std::forward<Args>(args)...), type);
+    }
+#else
+    /*!
+     * \brief echo function puts the arguments in place of the {} of the format and queues the record; without fmt, format specs are not supported.
+     */
+    template <typename... Args>
+    static void echo(
+        const uint              counter,
+        const time_t            occurTime,
+        const uint              line,
+        std::string_view        function,
+        std::string_view        file,
+        const LoggerType        type,
+        std::string_view        format,
+        Args&&...               args)
+    {
+        std::string text{};
+        std::size_t from{};
+        const auto append = [&text, &from, format](const auto& value) {
+            const auto at = format.find("{}", from);
+            if(at == std::string_view::npos) return;
+            std::ostringstream stream{};
+            stream << value;
+            text.append(format.substr(from, at - from)).append(stream.str());
+            from = at + 2;
+        };
+        (append(args), ...);
+        text.append(format.substr(std::min(from, format.size())));
+        echo(counter, occurTime, line, function, file, text, type);
+    }
+#endif
+
+    /*!
+     * \brief echoArguments function queues a structured record: a static format and its encoded arguments.
+     */
+    static void echoArguments(
+        const uint          counter,
+        const time_t        occurTime,
+        const uint          line,
+        std::string_view    function,
+        std::string_view    file,
+        std::string_view    format,
+        std::string_view    arguments,
+        const int           type);
+
+    /*!
+     * \brief levelOf function returns the severity of a logger type.
+     */
+    __tegra_no_discard static constexpr LogLevel levelOf(const int type) __tegra_noexcept
+    {
+        switch (type) {
+        case LoggerType::Default:   return LogLevel::Debug;
+        case LoggerType::Warning:   return LogLevel::Warning;
+        case LoggerType::Failed:    return LogLevel::Error;
+        case LoggerType::Critical:  return LogLevel::Critical;
+        default:                    return LogLevel::Info;
+        }
+    }
+
+    //! The other operand of the Log macro; never evaluated.
+    template <typename T> requires (!std::is_convertible_v<T, int>)
+    __tegra_no_discard static constexpr LogLevel levelOf(const T&) __tegra_noexcept
+    {
+        return LogLevel::Off;
+    }
+
+    /*!
+     * \brief enabled function checks a level against the compile-time and the runtime thresholds.
+     */
+    __tegra_no_discard static bool enabled(const LogLevel level) __tegra_noexcept
+    {
+#if TEGRA_LOG_MIN_LEVEL > 0
+        if(static_cast<u8>(level) < TEGRA_LOG_MIN_LEVEL) return false;
+#endif
+        return static_cast<u8>(level) >= MinimumLevel.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief admit function takes a token of the call's bucket; when there is none, the record is counted as suppressed.
+     */
+    __tegra_no_discard static bool admit(LogSite& site, std::string_view function, std::string_view file, const uint line) __tegra_noexcept;
+
+    /*!
+     * \brief setLevel function sets the runtime threshold; levels below TEGRA_LOG_MIN_LEVEL stay removed.
+     */
+    static void setLevel(const LogLevel level) __tegra_noexcept;
+
+    /*!
+     * \brief flush function waits until every queued record has been written.
+     */
+    static void flush();
+
+    /*!
+     * \brief shutdown function writes the queued records and stops the sink thread; later records are written on the calling thread.
+     * It runs at exit by itself.
+     */
+    static void shutdown();
+
+    /*!
+     * \brief dropped function returns the number of records dropped because the queue was full.
+     */
+    __tegra_no_discard static u64 dropped() __tegra_noexcept;
+
 };
 
 TEGRA_NAMESPACE_END
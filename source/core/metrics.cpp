@@ -0,0 +1,602 @@
+//! Tegra's Metrics.
+#ifdef __has_include
+# if __has_include("metrics.hpp")
+#   include "metrics.hpp"
+#else
+#   error "Tegra's metrics was not found!"
+# endif
+#endif
+
+//! Tegra's Logger.
+#ifdef __has_include
+# if __has_include(<logger>)
+#   include <logger>
+#else
+#   error "Tegra's logger was not found!"
+# endif
+#endif
+
+//! Tegra's Cache Manager.
+#ifdef __has_include
+# if __has_include("cache/manager.hpp")
+#   include "cache/manager.hpp"
+#else
+#   error "Tegra's cache manager was not found!"
+# endif
+#endif
+
+//! Tegra's Redis Cache.
+#ifdef __has_include
+# if __has_include("cache/redis.hpp")
+#   include "cache/redis.hpp"
+#else
+#   error "Tegra's redis cache was not found!"
+# endif
+#endif
+
+//! Tegra's Table Cache.
+#ifdef __has_include
+# if __has_include("cache/table.hpp")
+#   include "cache/table.hpp"
+#else
+#   error "Tegra's table cache was not found!"
+# endif
+#endif
+
+//! Tegra's Cache Tags.
+#ifdef __has_include
+# if __has_include("cache/tags.hpp")
+#   include "cache/tags.hpp"
+#else
+#   error "Tegra's cache tags was not found!"
+# endif
+#endif
+
+//! Tegra's Database Query.
+#ifdef __has_include
+# if __has_include("database/query.hpp")
+#   include "database/query.hpp"
+#else
+#   error "Tegra's database query was not found!"
+# endif
+#endif
+
+//! Tegra's Database Tenant.
+#ifdef __has_include
+# if __has_include("database/tenant.hpp")
+#   include "database/tenant.hpp"
+#else
+#   error "Tegra's database tenant was not found!"
+# endif
+#endif
+
+//! Tegra's Tracing.
+#ifdef __has_include
+# if __has_include("tracing.hpp")
+#   include "tracing.hpp"
+#else
+#   error "Tegra's tracing was not found!"
+# endif
+#endif
+
+//! Tegra's Translator.
+#ifdef __has_include
+# if __has_include("translator/translator.hpp")
+#   include "translator/translator.hpp"
+#else
+#   error "Tegra's translator was not found!"
+# endif
+#endif
+
+#if defined(PLATFORM_MAC)
+#include <mach/mach.h>
+#elif defined(PLATFORM_LINUX)
+#include <unistd.h>
+#elif defined(PLATFORM_WINDOWS)
+#include <Windows.h>
+#include <Psapi.h>
+#pragma comment(lib, "psapi.lib")
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::System)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+//! Series a thread keeps for the responses it has seen; the route labels are bounded, so only odd methods and statuses reach it.
+constexpr std::size_t THREAD_SERIES = 1024;
+
+constexpr double MICROS_PER_SECOND = 1000000.0;
+
+std::string escapeLabel(std::string_view value)
+{
+    std::string res{};
+    res.reserve(value.size());
+    for(const char c : value) {
+        switch (c) {
+        case '\\': res += "\\\\"; break;
+        case '"':  res += "\\\""; break;
+        case '\n': res += "\\n";  break;
+        default:   res.push_back(c);
+        }
+    }
+    return res;
+}
+
+std::string escapeHelp(std::string_view value)
+{
+    std::string res{};
+    res.reserve(value.size());
+    for(const char c : value) {
+        switch (c) {
+        case '\\': res += "\\\\"; break;
+        case '\n': res += "\\n";  break;
+        default:   res.push_back(c);
+        }
+    }
+    return res;
+}
+
+std::string number(double value)
+{
+    if(std::isnan(value)) return "NaN";
+    if(std::isinf(value)) return value > 0 ? "+Inf" : "-Inf";
+    return fmt::format("{}", value);
+}
+
+std::string_view typeOf(const MetricType type) __tegra_noexcept
+{
+    switch (type) {
+    case MetricType::Counter:   return "counter";
+    case MetricType::Gauge:     return "gauge";
+    case MetricType::Histogram: return "histogram";
+    case MetricType::Summary:   return "summary";
+    default:                    return "untyped";
+    }
+}
+
+double ratio(u64 hits, u64 misses) __tegra_noexcept
+{
+    const auto lookups = hits + misses;
+    return lookups == __tegra_zero ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+void writeCache(MetricWriter& writer, const std::string& backend, const Cache::CacheStats& stats)
+{
+    const MetricLabels labels { { "backend", backend } };
+    writer.family("tegra_cache_hits_total", "Cache lookups that found a fresh value.", MetricType::Counter);
+    writer.sample("tegra_cache_hits_total", labels, stats.hits);
+    writer.family("tegra_cache_misses_total", "Cache lookups that found nothing or an expired value.", MetricType::Counter);
+    writer.sample("tegra_cache_misses_total", labels, stats.misses);
+    writer.family("tegra_cache_evictions_total", "Cache entries dropped to make room.", MetricType::Counter);
+    writer.sample("tegra_cache_evictions_total", labels, stats.evictions);
+    writer.family("tegra_cache_entries", "Cache entries currently stored.", MetricType::Gauge);
+    writer.sample("tegra_cache_entries", labels, stats.entries);
+    writer.family("tegra_cache_bytes", "Cache bytes currently accounted.", MetricType::Gauge);
+    writer.sample("tegra_cache_bytes", labels, stats.bytes);
+    writer.family("tegra_cache_hit_ratio", "Share of cache lookups that found a fresh value.", MetricType::Gauge);
+    writer.sample("tegra_cache_hit_ratio", labels, ratio(stats.hits, stats.misses));
+}
+
+void collectCache(MetricWriter& writer)
+{
+    auto& cache = Cache::CacheManager::instance();
+    if(const auto* memory = dynamic_cast<const Cache::MemoryCache*>(&cache)) {
+        writeCache(writer, "memory", memory->stats());
+        const auto namespaces = memory->namespaces();
+        const auto each = [&](std::string_view name, std::string_view help, const MetricType type, const auto& value) {
+            writer.family(name, help, type);
+            for(const auto& n : namespaces) {
+                writer.sample(name, { { "namespace", n.name.empty() ? "shared" : n.name } }, value(n));
+            }
+        };
+        each("tegra_cache_namespace_hits_total", "Lookups of a namespace that found a fresh value.", MetricType::Counter,
+             [](const Cache::NamespaceStats& n) { return n.hits; });
+        each("tegra_cache_namespace_misses_total", "Lookups of a namespace that found nothing or an expired value.", MetricType::Counter,
+             [](const Cache::NamespaceStats& n) { return n.misses; });
+        each("tegra_cache_namespace_evictions_total", "Entries of a namespace dropped to make room.", MetricType::Counter,
+             [](const Cache::NamespaceStats& n) { return n.evictions; });
+        each("tegra_cache_namespace_rejections_total", "Entries refused by the admission filter of a namespace.", MetricType::Counter,
+             [](const Cache::NamespaceStats& n) { return n.rejections; });
+        each("tegra_cache_namespace_bytes", "Bytes stored in a namespace.", MetricType::Gauge,
+             [](const Cache::NamespaceStats& n) { return n.bytes; });
+        each("tegra_cache_namespace_quota_bytes", "Bytes reserved for a namespace.", MetricType::Gauge,
+             [](const Cache::NamespaceStats& n) { return n.quota; });
+        each("tegra_cache_namespace_hit_ratio", "Share of the lookups of a namespace that found a fresh value.", MetricType::Gauge,
+             [](const Cache::NamespaceStats& n) { return ratio(n.hits, n.misses); });
+    } else if(const auto* redis = dynamic_cast<const Cache::RedisCache*>(&cache)) {
+        writeCache(writer, "redis", redis->stats());
+    } else if(const auto* table = dynamic_cast<const Cache::TableCache*>(&cache)) {
+        const auto stats = table->stats();
+        writer.family("tegra_cache_table_flushes_total", "Write-behind flushes that wrote at least one row.", MetricType::Counter);
+        writer.sample("tegra_cache_table_flushes_total", {}, stats.flushes);
+        writer.family("tegra_cache_table_rows_total", "Rows written or deleted by the write-behind flushes.", MetricType::Counter);
+        writer.sample("tegra_cache_table_rows_total", {}, stats.rows);
+        writer.family("tegra_cache_table_failures_total", "Failed write-behind statements.", MetricType::Counter);
+        writer.sample("tegra_cache_table_failures_total", {}, stats.failures);
+        writer.family("tegra_cache_table_pending", "Writes waiting for the next flush.", MetricType::Gauge);
+        writer.sample("tegra_cache_table_pending", {}, stats.pending);
+    }
+
+    const auto tags = Cache::TagIndex::stats();
+    writer.family("tegra_cache_tag_invalidations_total", "Tag invalidations.", MetricType::Counter);
+    writer.sample("tegra_cache_tag_invalidations_total", {}, tags.invalidations);
+    writer.family("tegra_cache_tag_purged_total", "Cache entries deleted by tag invalidations.", MetricType::Counter);
+    writer.sample("tegra_cache_tag_purged_total", {}, tags.purged);
+    writer.family("tegra_cache_tag_keys", "Cache entries in the tag index.", MetricType::Gauge);
+    writer.sample("tegra_cache_tag_keys", {}, tags.keys);
+}
+
+void collectDatabase(MetricWriter& writer)
+{
+    writer.family("tegra_db_statement_duration_seconds", "Latency of the statements by fingerprint.", MetricType::Summary);
+    Database::QueryStatistics::forEach([&writer](const std::string& fingerprint, const Database::StatementStats& stats) {
+        writer.summary("tegra_db_statement_duration_seconds", { { "statement", fingerprint } }, stats.latency,
+                       stats.totalMicros.load(std::memory_order_relaxed));
+    });
+    writer.family("tegra_db_statement_errors_total", "Failed executions of the statements by fingerprint.", MetricType::Counter);
+    Database::QueryStatistics::forEach([&writer](const std::string& fingerprint, const Database::StatementStats& stats) {
+        writer.sample("tegra_db_statement_errors_total", { { "statement", fingerprint } }, stats.errors.load(std::memory_order_relaxed));
+    });
+
+    const auto query = Database::Query::stats();
+    writer.family("tegra_db_query_cache_hits_total", "Results served from the query cache.", MetricType::Counter);
+    writer.sample("tegra_db_query_cache_hits_total", {}, query.hits);
+    writer.family("tegra_db_query_cache_misses_total", "Statements executed against the database.", MetricType::Counter);
+    writer.sample("tegra_db_query_cache_misses_total", {}, query.misses);
+    writer.family("tegra_db_query_cache_hit_ratio", "Share of the read statements served from the query cache.", MetricType::Gauge);
+    writer.sample("tegra_db_query_cache_hit_ratio", {}, ratio(query.hits, query.misses));
+    writer.family("tegra_db_query_cache_entries", "Results stored in the query cache.", MetricType::Gauge);
+    writer.sample("tegra_db_query_cache_entries", {}, query.entries);
+
+    writer.family("tegra_db_tenant_pools", "Open tenant pools.", MetricType::Gauge);
+    writer.sample("tegra_db_tenant_pools", {}, static_cast<u64>(Database::TenantRouter::openPools()));
+    writer.family("tegra_db_tenant_pools_max", "Upper bound of open tenant pools.", MetricType::Gauge);
+    writer.sample("tegra_db_tenant_pools_max", {}, static_cast<u64>(Database::TenantRouter::maxPools.load()));
+}
+
+void collectProcess(MetricWriter& writer)
+{
+    writer.family("process_resident_memory_bytes", "Resident memory size in bytes.", MetricType::Gauge);
+    writer.sample("process_resident_memory_bytes", {}, Metrics::residentMemory());
+    writer.family("tegra_log_dropped_total", "Log records dropped because the queue of the logger was full.", MetricType::Counter);
+    writer.sample("tegra_log_dropped_total", {}, eLogger::Logger::dropped());
+    writer.family("tegra_trace_spans_dropped_total", "Sampled spans dropped because the queue of the exporter was full.", MetricType::Counter);
+    writer.sample("tegra_trace_spans_dropped_total", {}, Tracer::dropped());
+    writer.family("tegra_translation_misses_total", "Translations that found no word for their key.", MetricType::Counter);
+    writer.sample("tegra_translation_misses_total", {}, Translation::Translator::misses.load(std::memory_order_relaxed));
+}
+
+TEGRA_NAMESPACE_END
+
+u32 MetricShards::index() __tegra_noexcept
+{
+    thread_local const u32 shard = m_next.fetch_add(1, std::memory_order_relaxed) % Count;
+    return shard;
+}
+
+void Counter::add(u64 value) __tegra_noexcept
+{
+    m_shards[MetricShards::index()].value.fetch_add(value, std::memory_order_relaxed);
+}
+
+u64 Counter::value() const __tegra_noexcept
+{
+    u64 res{};
+    for(const auto& shard : m_shards) res += shard.value.load(std::memory_order_relaxed);
+    return res;
+}
+
+void Gauge::set(double value) __tegra_noexcept
+{
+    m_value.store(value, std::memory_order_relaxed);
+}
+
+void Gauge::add(double value) __tegra_noexcept
+{
+    m_value.fetch_add(value, std::memory_order_relaxed);
+}
+
+double Gauge::value() const __tegra_noexcept
+{
+    return m_value.load(std::memory_order_relaxed);
+}
+
+void Histogram::record(u64 micros) __tegra_noexcept
+{
+    auto& shard = m_shards[MetricShards::index()];
+    shard.values.record(micros);
+    shard.sum.fetch_add(micros, std::memory_order_relaxed);
+}
+
+u64 Histogram::count() const __tegra_noexcept
+{
+    u64 res{};
+    for(const auto& shard : m_shards) res += shard.values.count();
+    return res;
+}
+
+u64 Histogram::sum() const __tegra_noexcept
+{
+    u64 res{};
+    for(const auto& shard : m_shards) res += shard.sum.load(std::memory_order_relaxed);
+    return res;
+}
+
+std::array<u64, Histogram::Bounds.size()> Histogram::cumulative() const __tegra_noexcept
+{
+    //! Buckets are ordered by their upper bound, so one pass places every bucket under the first bound it fits.
+    std::array<u64, Bounds.size()> res{};
+    for(const auto& shard : m_shards) {
+        std::size_t bound{};
+        for(u32 i = 0; i < Database::LatencyHistogram::Buckets && bound < Bounds.size(); ++i) {
+            while(bound < Bounds.size() && Database::LatencyHistogram::upperBound(i) > Bounds[bound]) ++bound;
+            if(bound < Bounds.size()) res[bound] += shard.values.bucket(i);
+        }
+    }
+    for(std::size_t i = 1; i < res.size(); ++i) res[i] += res[i - 1];
+    return res;
+}
+
+void MetricWriter::family(std::string_view name, std::string_view help, const MetricType type)
+{
+    m_text += "# HELP ";
+    m_text += name;
+    m_text += ' ';
+    m_text += escapeHelp(help);
+    m_text += "\n# TYPE ";
+    m_text += name;
+    m_text += ' ';
+    m_text += typeOf(type);
+    m_text += '\n';
+}
+
+void MetricWriter::labels(const MetricLabels& labels, std::string_view extraName, std::string_view extraValue)
+{
+    if(labels.empty() && extraName.empty()) {
+        return;
+    }
+    m_text += '{';
+    bool first = true;
+    for(const auto& [name, value] : labels) {
+        if(!first) m_text += ',';
+        first = false;
+        m_text += name + "=\"" + escapeLabel(value) + "\"";
+    }
+    if(!extraName.empty()) {
+        if(!first) m_text += ',';
+        m_text += FROM_TEGRA_STRING(extraName) + "=\"" + FROM_TEGRA_STRING(extraValue) + "\"";
+    }
+    m_text += '}';
+}
+
+void MetricWriter::sample(std::string_view name, const MetricLabels& labels, double value)
+{
+    m_text += name;
+    this->labels(labels);
+    m_text += ' ' + number(value) + '\n';
+}
+
+void MetricWriter::sample(std::string_view name, const MetricLabels& labels, u64 value)
+{
+    m_text += name;
+    this->labels(labels);
+    m_text += ' ' + TO_TEGRA_STRING(value) + '\n';
+}
+
+void MetricWriter::histogram(std::string_view name, const MetricLabels& labels, const Histogram& histogram)
+{
+    const auto buckets = histogram.cumulative();
+    const auto count = std::max(histogram.count(), buckets.back());
+    for(std::size_t i = 0; i < buckets.size(); ++i) {
+        m_text += FROM_TEGRA_STRING(name) + "_bucket";
+        this->labels(labels, "le", number(static_cast<double>(Histogram::Bounds[i]) / MICROS_PER_SECOND));
+        m_text += ' ' + TO_TEGRA_STRING(buckets[i]) + '\n';
+    }
+    m_text += FROM_TEGRA_STRING(name) + "_bucket";
+    this->labels(labels, "le", "+Inf");
+    m_text += ' ' + TO_TEGRA_STRING(count) + '\n';
+    sample(FROM_TEGRA_STRING(name) + "_sum", labels, static_cast<double>(histogram.sum()) / MICROS_PER_SECOND);
+    sample(FROM_TEGRA_STRING(name) + "_count", labels, count);
+}
+
+void MetricWriter::summary(std::string_view name, const MetricLabels& labels, const Database::LatencyHistogram& histogram, u64 sum)
+{
+    for(const auto q : { 0.5, 0.95, 0.99 }) {
+        m_text += name;
+        this->labels(labels, "quantile", number(q));
+        m_text += ' ' + number(static_cast<double>(histogram.percentile(q)) / MICROS_PER_SECOND) + '\n';
+    }
+    sample(FROM_TEGRA_STRING(name) + "_sum", labels, static_cast<double>(sum) / MICROS_PER_SECOND);
+    sample(FROM_TEGRA_STRING(name) + "_count", labels, histogram.count());
+}
+
+std::string MetricWriter::str() &&
+{
+    return std::move(m_text);
+}
+
+Metrics::Family& Metrics::familyOf(const std::string& name, const std::string& help, const MetricType type)
+{
+    auto [it, inserted] = m_families.try_emplace(name);
+    if(inserted) {
+        it->second.help = help;
+        it->second.type = type;
+    } else if(it->second.type != type) {
+        eLogger::Log(eLogger::LoggerType::Warning, "Metric [{}] is registered with another type; the new series is not exported.", name);
+    }
+    return it->second;
+}
+
+Counter& Metrics::counter(const std::string& name, const std::string& help, const MetricLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return seriesOf(familyOf(name, help, MetricType::Counter).counters, labels);
+}
+
+Gauge& Metrics::gauge(const std::string& name, const std::string& help, const MetricLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return seriesOf(familyOf(name, help, MetricType::Gauge).gauges, labels);
+}
+
+Histogram& Metrics::histogram(const std::string& name, const std::string& help, const MetricLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return seriesOf(familyOf(name, help, MetricType::Histogram).histograms, labels);
+}
+
+void Metrics::collect(const MetricCollector& collector)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_collectors.push_back(collector);
+}
+
+std::string Metrics::scrape()
+{
+    MetricWriter writer{};
+    std::vector<MetricCollector> collectors{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(const auto& [name, family] : m_families) {
+            writer.family(name, family.help, family.type);
+            switch (family.type) {
+            case MetricType::Counter:
+                for(const auto& [key, c] : family.counters) writer.sample(name, c.first, c.second->value());
+                break;
+            case MetricType::Gauge:
+                for(const auto& [key, g] : family.gauges) writer.sample(name, g.first, g.second->value());
+                break;
+            case MetricType::Histogram:
+                for(const auto& [key, h] : family.histograms) writer.histogram(name, h.first, *h.second);
+                break;
+            default:
+                break;
+            }
+        }
+        collectors = m_collectors;
+    }
+    //! Collectors run without the registry lock, so they may register series themselves.
+    for(const auto& collector : collectors) {
+        collector(writer);
+    }
+    return std::move(writer).str();
+}
+
+void Metrics::configure(const JSonData& section)
+{
+    if(!section.isNull()) {
+        if(section.isMember("enabled"))     enabled     = BOOLCOMBINER(section, "enabled");
+        if(section.isMember("route_limit")) routeLimit  = section["route_limit"].asUInt();
+        VectorString allow{};
+        for(const auto& address : section["allow"]) allow.push_back(address.asString());
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_allow = std::move(allow);
+    }
+    std::call_once(m_builtins, []() {
+        collect(collectProcess);
+        collect(collectDatabase);
+        collect(collectCache);
+        AppFramework::application().registerPreSendingAdvice([](const Framework::HttpRequestPtr& req, const Framework::HttpResponsePtr& resp) {
+            const auto micros = trantor::Date::now().microSecondsSinceEpoch() - req->creationDate().microSecondsSinceEpoch();
+            observe(req->methodString(), routeOf(req->path()), static_cast<int>(resp->statusCode()), static_cast<u64>(std::max<s64>(micros, 0)));
+        });
+    });
+}
+
+bool Metrics::admitRoute(const std::string& route)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(m_routesMutex);
+        if(m_routes.contains(route)) return true;
+    }
+    std::unique_lock<std::shared_mutex> lock(m_routesMutex);
+    if(m_routes.contains(route)) return true;
+    if(m_routes.size() >= routeLimit.load(std::memory_order_relaxed)) return false;
+    m_routes.insert(route);
+    return true;
+}
+
+Metrics::RequestSeries Metrics::requestSeries(std::string_view method, const std::string& label, int status)
+{
+    RequestSeries res{};
+    res.requests = &counter("tegra_http_requests_total", "Responses by method, route and status.",
+                            { { "method", FROM_TEGRA_STRING(method) }, { "route", label }, { "status", TO_TEGRA_STRING(status) } });
+    res.latency  = &histogram("tegra_http_request_duration_seconds", "Time from the arrival of a request to its response, by method and route.",
+                             { { "method", FROM_TEGRA_STRING(method) }, { "route", label } });
+    return res;
+}
+
+void Metrics::observe(std::string_view method, std::string_view route, int status, u64 micros)
+{
+    //! Every thread keeps the admitted routes and the series it has used, so a response is counted without touching the registry.
+    //! Routes beyond the limit are looked up again each time, under a shared lock; only their label "other" is cached.
+    thread_local std::unordered_set<std::string> routes{};
+    thread_local std::unordered_map<std::string, RequestSeries> cache{};
+    thread_local std::string label{};
+    label.assign(route);
+    if(!routes.contains(label)) {
+        if(admitRoute(label)) {
+            routes.insert(label);
+        } else {
+            label = "other";
+        }
+    }
+    std::string key{};
+    key.reserve(method.size() + label.size() + 5);
+    key.append(method).append(TO_TEGRA_STRING(status)).append(label);
+    RequestSeries series{};
+    if(const auto it = cache.find(key); it != cache.end()) {
+        series = it->second;
+    } else {
+        series = requestSeries(method, label, status);
+        if(cache.size() < THREAD_SERIES) cache.emplace(std::move(key), series);
+    }
+    series.requests->add();
+    series.latency->record(micros);
+}
+
+std::string_view Metrics::routeOf(std::string_view path) __tegra_noexcept
+{
+    if(path.size() <= 1) {
+        return "/";
+    }
+    const auto end = path.find('/', 1);
+    return path.substr(0, end == std::string_view::npos ? path.size() : end);
+}
+
+bool Metrics::isAllowed(const std::string& address)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allow.empty() || std::find(m_allow.begin(), m_allow.end(), address) != m_allow.end();
+}
+
+u64 Metrics::residentMemory()
+{
+#if defined(PLATFORM_LINUX)
+    std::ifstream statm("/proc/self/statm");
+    u64 size{}, resident{};
+    if(statm >> size >> resident) {
+        return resident * static_cast<u64>(sysconf(_SC_PAGESIZE));
+    }
+    return __tegra_zero;
+#elif defined(PLATFORM_MAC)
+    mach_task_basic_info info{};
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if(task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        return static_cast<u64>(info.resident_size);
+    }
+    return __tegra_zero;
+#elif defined(PLATFORM_WINDOWS)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<u64>(counters.WorkingSetSize);
+    }
+    return __tegra_zero;
+#else
+    return __tegra_zero;
+#endif
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,289 @@
+/*!
+ * @file        metrics.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Registry of counters, gauges and histograms in the Prometheus text format.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_METRICS_HPP
+#define TEGRA_METRICS_HPP
+
+//! Tegra's Database Statistics.
+#ifdef __has_include
+# if __has_include("database/statistics.hpp")
+#   include "database/statistics.hpp"
+#else
+#   error "Tegra's database statistics was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::System)
+
+using MetricLabels = std::vector<std::pair<std::string, std::string>>; ///< Label names and values of a series.
+
+/*!
+ * @brief The MetricType enum lists the types of the exposition format.
+ */
+__tegra_enum_class MetricType : u8
+{
+    Counter     =   0x0,    ///<Only ever grows.
+    Gauge       =   0x1,    ///<Goes up and down.
+    Histogram   =   0x2,    ///<Distribution over cumulative buckets.
+    Summary     =   0x3     ///<Distribution as quantiles.
+};
+
+/*!
+ * @brief The MetricShards class hands every thread its own shard, so the threads updating a series do not share a cache line.
+ */
+class __tegra_export MetricShards final
+{
+public:
+    __tegra_inline_static_constexpr u32 Count = 8;
+
+    /*!
+     * @brief index function returns the shard of the calling thread.
+     */
+    __tegra_no_discard static u32 index() __tegra_noexcept;
+
+private:
+    __tegra_inline_static std::atomic<u32> m_next {};
+};
+
+/*!
+ * @brief The Counter class is a monotonic counter split into per-thread shards and summed on scrape.
+ */
+class __tegra_export Counter final
+{
+public:
+    void add(u64 value = 1) __tegra_noexcept;
+    __tegra_no_discard u64 value() const __tegra_noexcept;
+
+private:
+    struct alignas(64) Shard final
+    {
+        std::atomic<u64> value {};
+    };
+    std::array<Shard, MetricShards::Count> m_shards {};
+};
+
+/*!
+ * @brief The Gauge class holds the last value set.
+ */
+class __tegra_export Gauge final
+{
+public:
+    void set(double value) __tegra_noexcept;
+    void add(double value) __tegra_noexcept;
+    __tegra_no_discard double value() const __tegra_noexcept;
+
+private:
+    std::atomic<double> m_value {};
+};
+
+/*!
+ * @brief The Histogram class records microsecond values into per-thread log-linear histograms.
+ * On scrape the shards are merged into the cumulative buckets of the exposition, which are exact to the 6.25% of a LatencyHistogram bucket.
+ */
+class __tegra_export Histogram final
+{
+public:
+    /*!
+     * @brief Bounds are the upper bounds of the exposed buckets in microseconds.
+     */
+    __tegra_inline_static_constexpr std::array<u64, 14> Bounds {
+        500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 2500000, 5000000, 10000000
+    };
+
+    /*!
+     * @brief record function adds a value.
+     * @param micros is the value in microseconds.
+     */
+    void record(u64 micros) __tegra_noexcept;
+
+    /*!
+     * @brief count function returns the number of recorded values.
+     */
+    __tegra_no_discard u64 count() const __tegra_noexcept;
+
+    /*!
+     * @brief sum function returns the sum of recorded values in microseconds.
+     */
+    __tegra_no_discard u64 sum() const __tegra_noexcept;
+
+    /*!
+     * @brief cumulative function returns, for every bound, the number of values of at most that bound.
+     */
+    __tegra_no_discard std::array<u64, Bounds.size()> cumulative() const __tegra_noexcept;
+
+private:
+    struct alignas(64) Shard final
+    {
+        Database::LatencyHistogram  values  {};
+        std::atomic<u64>            sum     {};
+    };
+    std::array<Shard, MetricShards::Count> m_shards {};
+};
+
+/*!
+ * @brief The MetricWriter class writes families and samples in the Prometheus text exposition format 0.0.4.
+ */
+class __tegra_export MetricWriter final
+{
+public:
+    /*!
+     * @brief family function writes the HELP and TYPE lines of a metric.
+     */
+    void family(std::string_view name, std::string_view help, const MetricType type);
+
+    /*!
+     * @brief sample function writes one sample.
+     */
+    void sample(std::string_view name, const MetricLabels& labels, double value);
+    void sample(std::string_view name, const MetricLabels& labels, u64 value);
+
+    /*!
+     * @brief histogram function writes the buckets, sum and count of a histogram; the values are exposed in seconds.
+     */
+    void histogram(std::string_view name, const MetricLabels& labels, const Histogram& histogram);
+
+    /*!
+     * @brief summary function writes the quantiles, sum and count of a latency histogram; the values are exposed in seconds.
+     * @param sum is the sum of the values in microseconds.
+     */
+    void summary(std::string_view name, const MetricLabels& labels, const Database::LatencyHistogram& histogram, u64 sum);
+
+    /*!
+     * @brief str function returns the written text.
+     */
+    __tegra_no_discard std::string str() &&;
+
+private:
+    void labels(const MetricLabels& labels, std::string_view extraName = {}, std::string_view extraValue = {});
+    std::string m_text {};
+};
+
+using MetricCollector = std::function<void(MetricWriter&)>;
+
+/*!
+ * @brief The Metrics class is the registry of the application.
+ * Series are created once and updated without locks; look them up once and keep the reference, as the series live until exit.
+ * A scrape walks the series and the collectors, so its cost grows with the number of series and never with the number of requests.
+ * Collectors publish the counters that other parts of the system already keep, at scrape time.
+ */
+class __tegra_export Metrics final
+{
+public:
+    /*!
+     * @brief counter function returns the series of a counter, creating it on first use.
+     * @param name is the metric name, e.g. "tegra_http_requests_total".
+     */
+    __tegra_no_discard static Counter& counter(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+
+    /*!
+     * @brief gauge function returns the series of a gauge, creating it on first use.
+     */
+    __tegra_no_discard static Gauge& gauge(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+
+    /*!
+     * @brief histogram function returns the series of a histogram, creating it on first use.
+     * @param name is the metric name, e.g. "tegra_http_request_duration_seconds"; values are recorded in microseconds and exposed in seconds.
+     */
+    __tegra_no_discard static Histogram& histogram(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+
+    /*!
+     * @brief collect function adds a collector that runs on every scrape.
+     */
+    static void collect(const MetricCollector& collector);
+
+    /*!
+     * @brief scrape function returns every series and the output of every collector.
+     */
+    __tegra_no_discard static std::string scrape();
+
+    /*!
+     * @brief configure function reads the "metrics" section of the system config, registers the built-in collectors
+     * and starts observing the responses of the application.
+     */
+    static void configure(const JSonData& section);
+
+    /*!
+     * @brief observe function counts a response by method, route and status and records its latency.
+     * @param route is the route of the path; see routeOf. Beyond routeLimit distinct routes, new ones are counted as "other".
+     * @param micros is the time since the request arrived.
+     */
+    static void observe(std::string_view method, std::string_view route, int status, u64 micros);
+
+    /*!
+     * @brief routeOf function returns the route label of a path: its first segment, so ids and slugs below it share a series.
+     */
+    __tegra_no_discard static std::string_view routeOf(std::string_view path) __tegra_noexcept;
+
+    /*!
+     * @brief isAllowed checks if an address may scrape; every address may when the allow list is empty.
+     */
+    __tegra_no_discard static bool isAllowed(const std::string& address);
+
+    /*!
+     * @brief residentMemory function returns the resident set size of the process in bytes, zero if it is unknown.
+     */
+    __tegra_no_discard static u64 residentMemory();
+
+    __tegra_inline_static std::atomic<bool>     enabled     { true };   ///< The /metrics endpoint answers.
+    __tegra_inline_static std::atomic<u32>      routeLimit  { 64 };     ///< Distinct route labels; later routes are counted as "other".
+    __tegra_inline_static_constexpr std::string_view ContentType { "text/plain; version=0.0.4; charset=utf-8" };
+
+private:
+    template<typename T>
+    using SeriesMap = std::unordered_map<std::string, std::pair<MetricLabels, Scope<T>>>;  ///< Series by their encoded labels.
+
+    struct Family final
+    {
+        std::string             help        {};
+        MetricType              type        {};
+        SeriesMap<Counter>      counters    {};
+        SeriesMap<Gauge>        gauges      {};
+        SeriesMap<Histogram>    histograms  {};
+    };
+
+    struct RequestSeries final
+    {
+        Counter*    requests    { nullptr };
+        Histogram*  latency     { nullptr };
+    };
+
+    __tegra_no_discard static Family& familyOf(const std::string& name, const std::string& help, const MetricType type);
+    __tegra_no_discard static RequestSeries requestSeries(std::string_view method, const std::string& label, int status);
+    __tegra_no_discard static bool admitRoute(const std::string& route);
+
+    template<typename T>
+    __tegra_no_discard static T& seriesOf(SeriesMap<T>& series, const MetricLabels& labels)
+    {
+        std::string key{};
+        for(const auto& [name, value] : labels) {
+            key.append(name).push_back('\x1f');
+            key.append(value).push_back('\x1e');
+        }
+        auto [it, inserted] = series.try_emplace(std::move(key));
+        if(inserted) {
+            it->second = { labels, std::make_unique<T>() };
+        }
+        return *it->second.second;
+    }
+
+    __tegra_inline_static std::mutex                                m_mutex         {};
+    __tegra_inline_static std::map<std::string, Family>             m_families      {};
+    __tegra_inline_static std::vector<MetricCollector>              m_collectors    {};
+    __tegra_inline_static std::shared_mutex                         m_routesMutex   {};
+    __tegra_inline_static std::unordered_set<std::string>           m_routes        {};
+    __tegra_inline_static VectorString                              m_allow         {};
+    __tegra_inline_static std::once_flag                            m_builtins      {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_METRICS_HPP
@@ -16,11 +16,49 @@
 # endif
 #endif
 
+//! Tegra's Cache.
+#ifdef __has_include
+# if __has_include(<cache>)
+#   include <cache>
+#else
+#   error "Tegra's cache was not found!"
+# endif
+#endif
+
+//! Tegra's Tracing.
+#ifdef __has_include
+# if __has_include(<tracing>)
+#   include <tracing>
+#else
+#   error "Tegra's tracing was not found!"
+# endif
+#endif
+
 TEGRA_USING_NAMESPACE Tegra;
 TEGRA_USING_NAMESPACE Tegra::System;
+TEGRA_USING_NAMESPACE Tegra::Database;
 
 TEGRA_NAMESPACE_BEGIN(Tegra::SEO)
 
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+//! Seconds the loaded site config is served from the cache; writes invalidate it through its tags, and a shared backend caps it at TagIndex::sharedTtl.
+constexpr u32 CONFIG_TTL = 3600;
+
+//! The config is cached as "name\0value\0" pairs.
+void decodeConfig(std::string_view data, MapString& config)
+{
+    while(!data.empty()) {
+        const auto name = data.find('\0');
+        const auto value = name == std::string_view::npos ? name : data.find('\0', name + 1);
+        if(value == std::string_view::npos) break;
+        config.insert(PairString(std::string(data.substr(0, name)), std::string(data.substr(name + 1, value - name - 1))));
+        data.remove_prefix(value + 1);
+    }
+}
+
+TEGRA_NAMESPACE_END
+
 using iterMap = std::map<std::string, std::string>::iterator;
 
 MetaTag::MetaTag()
@@ -96,6 +134,7 @@ VectorString StaticMeta::metaData()
 
 void StaticMeta::setDefault(const std::string& path)
 {
+    Span span("StaticMeta::setDefault");
     Scope<MetaTag> meta(new MetaTag());
 
     m_staticPrivateMembers->config      = {};
@@ -113,14 +152,43 @@ void StaticMeta::setDefault(const std::string& path)
     {
         try
         {
-            auto clientPtr = AppFramework::application().getDbClient();
-            auto result = clientPtr->execSqlSync("SELECT * FROM " + app->engine->tablePrefix()
-                                                 + "config AS c INNER JOIN " + app->engine->tablePrefix()
-                                                 + "config_l AS cl ON cl.id = c.id WHERE language='"
-                                                 + app->language->getLanguage() + "'");
-            for (const auto &row : result)
-            {
-                m_staticPrivateMembers->config.insert(PairString(row["name"].as<std::string>(), row["value"].as<std::string>()));
+            //! The projected pair is a single in-memory lookup; the join is the fallback.
+            if(auto projection = Projection::snapshot(FROM_TEGRA_STRING(TEGRA_TABLES::CONFIG), app->language->getLanguage())) {
+                const auto& names = projection->values("name");
+                const auto& values = projection->values("value");
+                for(std::size_t i = 0; i < names.size() && i < values.size(); ++i) {
+                    m_staticPrivateMembers->config.insert(PairString(names[i], values[i]));
+                }
+            } else {
+                //! Concurrent misses share one query, and an expired copy is served while it is reloaded.
+                const auto language = app->language->getLanguage();
+                const auto tenant = TenantRouter::current();
+                const auto key = "seo.config:" + tenant.value_or(__tegra_null_str) + ":" + language;
+                const auto config = FROM_TEGRA_STRING(TableRegistry::name(TEGRA_TABLES::CONFIG));
+                const auto configValue = FROM_TEGRA_STRING(TableRegistry::name(TEGRA_TABLES::CONFIG_L));
+                //! Writes to either table drop the entry, so it can live long; the language is part of the key already.
+                const VectorString tags { "table:" + config, "table:" + configValue };
+                const auto cached = Cache::TagIndex::getOrCompute(key, CONFIG_TTL, tags, [language, tenant, config, configValue]() -> OptionalString {
+                    TenantScope scope(tenant);
+                    const Statement statement {
+                        .id     = "seo.config",
+                        .sql    = "SELECT * FROM " + config + " AS c INNER JOIN " + configValue
+                                  + " AS cl ON cl.id = c.id WHERE language=" + Query::placeholder(1),
+                        .tables = { config, configValue },
+                        //! A reload follows an invalidation, and a lagging replica would put the old rows back for an hour.
+                        .intent = QueryIntent::Read
+                    };
+                    std::string data{};
+                    for (const auto &row : Query::select(statement, language))
+                    {
+                        data.append(row["name"].as<std::string>()).push_back('\0');
+                        data.append(row["value"].as<std::string>()).push_back('\0');
+                    }
+                    return data;
+                });
+                if(cached.has_value()) {
+                    decodeConfig(cached.value(), m_staticPrivateMembers->config);
+                }
             }
             // Basic HTML Meta Tags
             // Site static data
@@ -202,15 +270,16 @@ void StaticMeta::setData(const MetaType& type, const MapString& data)
 
     try
     {
-        auto clientPtr = AppFramework::application().getDbClient();
-
         if(!m_staticStruct->module.empty()) {
             if(Database::Connection::isConnected()) {
-                auto result = clientPtr->execSqlSync("SELECT * FROM "
-                                                     + app->engine->tablePrefix() + m_staticStruct->module
-                                                     + " AS c INNER JOIN "
-                                                     + app->engine->tablePrefix() + m_staticStruct->module
-                                                     + "_l AS cl ON cl.id = c.id WHERE language='" + app->language->getLanguage() + "'");
+                const auto table = app->engine->tablePrefix() + m_staticStruct->module;
+                const Statement statement {
+                    .id     = "seo.module." + m_staticStruct->module,
+                    .sql    = "SELECT * FROM " + table + " AS c INNER JOIN " + table
+                              + "_l AS cl ON cl.id = c.id WHERE language=" + Query::placeholder(1),
+                    .tables = { table, table + "_l" }
+                };
+                auto result = Query::select(statement, app->language->getLanguage());
                 for (const auto& row : result)
                 {
                     m_staticPrivateMembers->config.insert(PairString(row["name"].as<std::string>(), row["value"].as<std::string>()));
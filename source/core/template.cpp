@@ -7,6 +7,15 @@
 # endif
 #endif
 
+//! Tegra's Tracing.
+#ifdef __has_include
+# if __has_include(<tracing>)
+#   include <tracing>
+#else
+#   error "Tegra's tracing was not found!"
+# endif
+#endif
+
 TEGRA_USING_NAMESPACE Tegra;
 TEGRA_USING_NAMESPACE Tegra::SEO;
 
@@ -14,6 +23,7 @@ TEGRA_NAMESPACE_BEGIN(Tegra::System)
 
 Template::Template(const UserType& usertype, const ApplicationData& appData) : utype(usertype)
 {
+    Span span("Template::Template");
     __tegra_safe_instance_rhs(staticMeta, StaticMeta, appData); //SEO
     //!Getting system language by redirecting url.
     languagePtr = CreateScope<Multilangual::Language>(appData.path.value());
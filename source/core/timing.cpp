@@ -0,0 +1,171 @@
+//! Tegra's Timing.
+#ifdef __has_include
+# if __has_include("timing.hpp")
+#   include "timing.hpp"
+#else
+#   error "Tegra's timing was not found!"
+# endif
+#endif
+
+//! Tegra's Metrics.
+#ifdef __has_include
+# if __has_include("metrics.hpp")
+#   include "metrics.hpp"
+#else
+#   error "Tegra's metrics was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::System)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+u64 microsSince(const std::chrono::steady_clock::time_point& start) __tegra_noexcept
+{
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+//! Series of the /metrics endpoint, looked up once; the last one is the whole page.
+std::array<Histogram*, static_cast<std::size_t>(Phase::Count) + 1>& phaseSeries()
+{
+    static std::array<Histogram*, static_cast<std::size_t>(Phase::Count) + 1> series = []() {
+        std::array<Histogram*, static_cast<std::size_t>(Phase::Count) + 1> res{};
+        for(std::size_t i = 0; i < res.size(); ++i) {
+            const auto name = i < static_cast<std::size_t>(Phase::Count) ? RequestTimer::nameOf(static_cast<Phase>(i)) : "total";
+            res[i] = &Metrics::histogram("tegra_page_phase_duration_seconds", "Time spent in the phases of a page.", { { "phase", FROM_TEGRA_STRING(name) } });
+        }
+        return res;
+    }();
+    return series;
+}
+
+JSonData describe(const Database::LatencyHistogram& histogram)
+{
+    JSonData res{};
+    res["count"]    = Json::UInt64(histogram.count());
+    res["p50"]      = Json::UInt64(histogram.percentile(0.50));
+    res["p95"]      = Json::UInt64(histogram.percentile(0.95));
+    res["p99"]      = Json::UInt64(histogram.percentile(0.99));
+    res["max"]      = Json::UInt64(histogram.max());
+    return res;
+}
+
+TEGRA_NAMESPACE_END
+
+RequestTimer::RequestTimer() : m_start(std::chrono::steady_clock::now()), m_previous(m_current)
+{
+    m_current = this;
+}
+
+RequestTimer::~RequestTimer()
+{
+    finish();
+    m_current = m_previous;
+}
+
+RequestTimer* RequestTimer::current() __tegra_noexcept
+{
+    return m_current;
+}
+
+void RequestTimer::add(const Phase phase, u64 micros) __tegra_noexcept
+{
+    m_phases[static_cast<std::size_t>(phase)] += micros;
+}
+
+u64 RequestTimer::phase(const Phase phase) const __tegra_noexcept
+{
+    return m_phases[static_cast<std::size_t>(phase)];
+}
+
+u64 RequestTimer::elapsed() const __tegra_noexcept
+{
+    return m_finished ? m_total : microsSince(m_start);
+}
+
+void RequestTimer::setSize(u64 bytes) __tegra_noexcept
+{
+    m_size = bytes;
+}
+
+u64 RequestTimer::size() const __tegra_noexcept
+{
+    return m_size;
+}
+
+std::string RequestTimer::serverTiming() const
+{
+    std::string res{};
+    const auto append = [&res](std::string_view name, u64 micros) {
+        if(!res.empty()) res += ", ";
+        res += FROM_TEGRA_STRING(name) + ";dur=" + TO_TEGRA_STRING(micros / 1000) + "." + fmt::format("{:03}", micros % 1000);
+    };
+    for(std::size_t i = 0; i < m_phases.size(); ++i) {
+        if(m_phases[i] != __tegra_zero) append(nameOf(static_cast<Phase>(i)), m_phases[i]);
+    }
+    append("total", elapsed());
+    return res;
+}
+
+void RequestTimer::finish() __tegra_noexcept
+{
+    if(m_finished) {
+        return;
+    }
+    m_total = microsSince(m_start);
+    m_finished = true;
+    auto& series = phaseSeries();
+    for(std::size_t i = 0; i < m_phases.size(); ++i) {
+        if(m_phases[i] == __tegra_zero) continue;
+        m_histograms[i].record(m_phases[i]);
+        series[i]->record(m_phases[i]);
+    }
+    m_totals.record(m_total);
+    series.back()->record(m_total);
+    if(m_size != __tegra_zero) {
+        m_sizes.record(m_size);
+        static auto& bytes = Metrics::counter("tegra_page_response_bytes_total", "Bytes of the rendered pages.");
+        bytes.add(m_size);
+    }
+}
+
+std::string_view RequestTimer::nameOf(const Phase phase) __tegra_noexcept
+{
+    switch (phase) {
+    case Phase::Language:       return "lang";
+    case Phase::Config:         return "config";
+    case Phase::Template:       return "template";
+    case Phase::Sql:            return "sql";
+    case Phase::Translation:    return "i18n";
+    case Phase::Render:         return "render";
+    default:                    return "other";
+    }
+}
+
+JSonData RequestTimer::snapshot()
+{
+    JSonData res{};
+    JSonData phases{};
+    for(std::size_t i = 0; i < m_histograms.size(); ++i) {
+        phases[FROM_TEGRA_STRING(nameOf(static_cast<Phase>(i)))] = describe(m_histograms[i]);
+    }
+    res["phases_us"]    = phases;
+    res["total_us"]     = describe(m_totals);
+    res["size_bytes"]   = describe(m_sizes);
+    return res;
+}
+
+PhaseTimer::PhaseTimer(const Phase phase) __tegra_noexcept : m_phase(phase), m_start(std::chrono::steady_clock::now())
+{
+}
+
+PhaseTimer::~PhaseTimer()
+{
+    if(auto* timer = RequestTimer::current()) {
+        timer->add(m_phase, microsSince(m_start));
+    }
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,138 @@
+/*!
+ * @file        timing.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Phase timing of a request.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_TIMING_HPP
+#define TEGRA_TIMING_HPP
+
+//! Tegra's Database Statistics.
+#ifdef __has_include
+# if __has_include("database/statistics.hpp")
+#   include "database/statistics.hpp"
+#else
+#   error "Tegra's database statistics was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::System)
+
+/*!
+ * @brief The Phase enum lists the measured parts of a page.
+ * Phases may overlap: the SQL time is also part of the phase that ran the statement.
+ */
+__tegra_enum_class Phase : u8
+{
+    Language    =   0x0,    ///<Language resolution.
+    Config      =   0x1,    ///<Configuration loading.
+    Template    =   0x2,    ///<Template and meta data build.
+    Sql         =   0x3,    ///<Statements run through the database layer.
+    Translation =   0x4,    ///<Translation lookups.
+    Render      =   0x5,    ///<View rendering.
+    Count       =   0x6
+};
+
+/*!
+ * @brief The RequestTimer class is the stopwatch of one request. It is the current timer of its thread while it lives,
+ * so the layers below (e.g. the database statistics) add their time without being handed the timer.
+ */
+class __tegra_export RequestTimer final
+{
+public:
+    RequestTimer();
+    ~RequestTimer();
+    TEGRA_DISABLE_COPY(RequestTimer)
+
+    /*!
+     * @brief current function returns the timer of the request running on this thread, or nullptr.
+     */
+    __tegra_no_discard static RequestTimer* current() __tegra_noexcept;
+
+    /*!
+     * @brief add function adds time to a phase.
+     * @param micros is the duration in microseconds.
+     */
+    void add(const Phase phase, u64 micros) __tegra_noexcept;
+
+    /*!
+     * @brief phase function returns the time of a phase in microseconds.
+     */
+    __tegra_no_discard u64 phase(const Phase phase) const __tegra_noexcept;
+
+    /*!
+     * @brief elapsed function returns the microseconds since the request started.
+     */
+    __tegra_no_discard u64 elapsed() const __tegra_noexcept;
+
+    /*!
+     * @brief setSize function sets the size of the response body in bytes.
+     */
+    void setSize(u64 bytes) __tegra_noexcept;
+
+    /*!
+     * @brief size function returns the size of the response body in bytes.
+     */
+    __tegra_no_discard u64 size() const __tegra_noexcept;
+
+    /*!
+     * @brief serverTiming function returns the value of the Server-Timing header, e.g. "sql;dur=1.250, total;dur=4.100".
+     */
+    __tegra_no_discard std::string serverTiming() const;
+
+    /*!
+     * @brief finish function stops the stopwatch and adds the request to the histograms; later calls do nothing.
+     * The destructor calls it.
+     */
+    void finish() __tegra_noexcept;
+
+    /*!
+     * @brief nameOf function returns the name of a phase in the Server-Timing header.
+     */
+    __tegra_no_discard static std::string_view nameOf(const Phase phase) __tegra_noexcept;
+
+    /*!
+     * @brief snapshot function returns count and percentiles of every phase, of the whole request and of the response size.
+     */
+    __tegra_no_discard static JSonData snapshot();
+
+    __tegra_inline_static std::atomic<bool> serverTimingHeader { false }; ///< Whether pages send the Server-Timing header; it tells any client where the time goes.
+
+private:
+    std::chrono::steady_clock::time_point                           m_start     {};
+    std::array<u64, static_cast<std::size_t>(Phase::Count)>         m_phases    {};
+    u64                                                             m_size      {};
+    u64                                                             m_total     {};
+    bool                                                            m_finished  { false };
+    RequestTimer*                                                   m_previous  { nullptr };
+
+    __tegra_inline_static thread_local RequestTimer*                                        m_current   { nullptr };
+    __tegra_inline_static std::array<Database::LatencyHistogram, static_cast<std::size_t>(Phase::Count)>  m_histograms {};
+    __tegra_inline_static Database::LatencyHistogram                                        m_totals    {};
+    __tegra_inline_static Database::LatencyHistogram                                        m_sizes     {};     ///< In bytes.
+};
+
+/*!
+ * @brief The PhaseTimer class adds the time of its scope to a phase of the current request.
+ */
+class __tegra_export PhaseTimer final
+{
+public:
+    explicit PhaseTimer(const Phase phase) __tegra_noexcept;
+    ~PhaseTimer();
+    TEGRA_DISABLE_COPY(PhaseTimer)
+
+private:
+    Phase                                   m_phase;
+    std::chrono::steady_clock::time_point   m_start;
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_TIMING_HPP
@@ -0,0 +1,508 @@
+//! Tegra's Tracing.
+#ifdef __has_include
+# if __has_include("tracing.hpp")
+#   include "tracing.hpp"
+#else
+#   error "Tegra's tracing was not found!"
+# endif
+#endif
+
+//! Tegra's Logger.
+#ifdef __has_include
+# if __has_include(<logger>)
+#   include <logger>
+#else
+#   error "Tegra's logger was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::System)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+constexpr std::size_t BATCH_SIZE = 512;
+constexpr auto EXPORT_INTERVAL = std::chrono::seconds(1);
+
+std::mt19937_64& engine()
+{
+    thread_local std::mt19937_64 engine { std::random_device{}() ^ static_cast<u64>(std::hash<std::thread::id>{}(std::this_thread::get_id())) };
+    return engine;
+}
+
+template <std::size_t N>
+void randomId(std::array<u8, N>& id) __tegra_noexcept
+{
+    //! An id of zeros is invalid.
+    do {
+        for(std::size_t i = 0; i < N; i += sizeof(u64)) {
+            const u64 value = engine()();
+            std::memcpy(id.data() + i, &value, std::min(sizeof(u64), N - i));
+        }
+    } while(std::all_of(id.begin(), id.end(), [](u8 b) { return b == 0; }));
+}
+
+template <std::size_t N>
+bool isZero(const std::array<u8, N>& id) __tegra_noexcept
+{
+    return std::all_of(id.begin(), id.end(), [](u8 b) { return b == 0; });
+}
+
+template <std::size_t N>
+bool fromHex(std::string_view text, std::array<u8, N>& id) __tegra_noexcept
+{
+    const auto digit = [](char c) -> int {
+        if(c >= '0' && c <= '9') return c - '0';
+        if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+        return -1;
+    };
+    if(text.size() != N * 2) {
+        return false;
+    }
+    for(std::size_t i = 0; i < N; ++i) {
+        const int high = digit(text[i * 2]);
+        const int low = digit(text[i * 2 + 1]);
+        if(high < 0 || low < 0) return false;
+        id[i] = static_cast<u8>(high << 4 | low);
+    }
+    return !isZero(id);
+}
+
+template <std::size_t N>
+std::string toHex(const std::array<u8, N>& id)
+{
+    constexpr std::string_view digits { "0123456789abcdef" };
+    std::string res(N * 2, '0');
+    for(std::size_t i = 0; i < N; ++i) {
+        res[i * 2]      = digits[id[i] >> 4];
+        res[i * 2 + 1]  = digits[id[i] & 0xF];
+    }
+    return res;
+}
+
+/*!
+ * @brief sampledId decides a new trace by its id, so every process seeing the id with the same rate decides alike.
+ */
+bool sampledId(const TraceId& id) __tegra_noexcept
+{
+    const auto rate = Tracer::sampleRate.load(std::memory_order_relaxed);
+    if(rate >= 1.0) return true;
+    if(rate <= 0.0) return false;
+    u64 value{};
+    for(std::size_t i = 8; i < id.size(); ++i) value = value << 8 | id[i];
+    return static_cast<double>(value) < rate * 18446744073709551616.0;
+}
+
+u64 unixNanoseconds() __tegra_noexcept
+{
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+std::string escape(std::string_view text)
+{
+    std::string res{};
+    res.reserve(text.size());
+    for(const char c : text) {
+        switch (c) {
+        case '"':  res += "\\\""; break;
+        case '\\': res += "\\\\"; break;
+        case '\n': res += "\\n";  break;
+        case '\r': res += "\\r";  break;
+        case '\t': res += "\\t";  break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20) {
+                res += fmt::format("\\u{:04x}", static_cast<int>(c));
+            } else {
+                res.push_back(c);
+            }
+        }
+    }
+    return res;
+}
+
+/*!
+ * @brief The Exporter class owns the queue of finished spans and the thread that appends them to the trace file.
+ */
+class Exporter final
+{
+public:
+    Exporter(const std::filesystem::path& file, const std::string& service) : m_file(file), m_service(service)
+    {
+        std::error_code error{};
+        if(m_file.has_parent_path()) {
+            std::filesystem::create_directories(m_file.parent_path(), error);
+        }
+        open();
+        m_running = true;
+        m_thread = std::thread([this] { run(); });
+        std::atexit([] { Tracer::shutdown(); });
+    }
+
+    static Exporter* get() __tegra_noexcept
+    {
+        return m_instance.load(std::memory_order_acquire);
+    }
+
+    static void start(const std::filesystem::path& file, const std::string& service)
+    {
+        //! Never destroyed, so spans ending at exit still find it; started once, like the logger sink.
+        static std::once_flag once{};
+        std::call_once(once, [&]() {
+            m_instance.store(new Exporter(file, service), std::memory_order_release);
+        });
+    }
+
+    void push(SpanData&& span)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(!m_running || m_queue.size() >= Tracer::maxQueue.load(std::memory_order_relaxed)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_queue.push_back(std::move(span));
+        if(m_queue.size() >= BATCH_SIZE) {
+            lock.unlock();
+            m_signal.notify_one();
+        }
+    }
+
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_flushes.fetch_add(1, std::memory_order_relaxed);
+        m_signal.notify_one();
+        m_idle.wait(lock, [this] { return !m_running || (m_queue.empty() && !m_writing); });
+    }
+
+    void shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(!m_running) {
+                return;
+            }
+            m_running = false;
+        }
+        m_signal.notify_one();
+        if(m_thread.joinable()) {
+            m_thread.join();
+        }
+        m_idle.notify_all();
+    }
+
+    u64 dropped() const __tegra_noexcept
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run()
+    {
+        std::vector<SpanData> batch{};
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(true) {
+            m_signal.wait_for(lock, EXPORT_INTERVAL, [this] {
+                return !m_running || m_queue.size() >= BATCH_SIZE || m_flushes.load(std::memory_order_relaxed) != __tegra_zero;
+            });
+            m_flushes.store(0, std::memory_order_relaxed);
+            batch.swap(m_queue);
+            m_writing = !batch.empty();
+            const bool running = m_running;
+            lock.unlock();
+            write(batch);
+            batch.clear();
+            lock.lock();
+            m_writing = false;
+            if(m_queue.empty()) {
+                m_idle.notify_all();
+            }
+            if(!running && m_queue.empty()) {
+                break;
+            }
+        }
+    }
+
+    void write(const std::vector<SpanData>& batch)
+    {
+        if(batch.empty() || !m_stream.is_open()) {
+            return;
+        }
+        for(std::size_t i = 0; i < batch.size(); i += BATCH_SIZE) {
+            const std::vector<SpanData> part(batch.begin() + static_cast<std::ptrdiff_t>(i),
+                                             batch.begin() + static_cast<std::ptrdiff_t>(std::min(batch.size(), i + BATCH_SIZE)));
+            const auto line = Tracer::encode(part, m_service);
+            m_stream << line << '\n';
+            m_written += line.size() + 1;
+            if(m_written >= Tracer::maxFileSize.load(std::memory_order_relaxed)) {
+                rotate();
+                if(!m_stream.is_open()) return;
+            }
+        }
+        m_stream.flush();
+    }
+
+    void open()
+    {
+        m_stream.open(m_file, std::ios::app);
+        if(!m_stream.is_open()) {
+            eLogger::Log(eLogger::LoggerType::Warning, "Trace file [{}] can not be opened; spans are dropped.", m_file.string());
+            return;
+        }
+        //! A file left by the previous run keeps growing until it reaches the limit.
+        std::error_code error{};
+        const auto size = std::filesystem::file_size(m_file, error);
+        m_written = error ? __tegra_zero : static_cast<u64>(size);
+    }
+
+    void rotate()
+    {
+        m_stream.close();
+        std::error_code error{};
+        const auto files = std::max<u32>(Tracer::maxFiles.load(std::memory_order_relaxed), 1);
+        std::filesystem::remove(pathOf(files), error);
+        for(auto i = files; i > 1; --i) {
+            std::filesystem::rename(pathOf(i - 1), pathOf(i), error);
+        }
+        std::filesystem::rename(m_file, pathOf(1), error);
+        open();
+    }
+
+    std::filesystem::path pathOf(const u32 index) const
+    {
+        auto res = m_file;
+        return res.replace_filename(m_file.stem().string() + "." + TO_TEGRA_STRING(index) + m_file.extension().string());
+    }
+
+    std::filesystem::path           m_file      {};
+    std::string                     m_service   {};
+    std::ofstream                   m_stream    {};
+    std::mutex                      m_mutex     {};
+    std::condition_variable         m_signal    {};
+    std::condition_variable         m_idle      {};
+    std::vector<SpanData>           m_queue     {};
+    std::thread                     m_thread    {};
+    bool                            m_running   { false };
+    bool                            m_writing   { false };
+    u64                             m_written   {};         ///< Bytes of the current file, touched by the exporter thread only.
+    std::atomic<u64>                m_flushes   {};
+    std::atomic<u64>                m_dropped   {};
+
+    __tegra_inline_static std::atomic<Exporter*> m_instance { nullptr };
+};
+
+TEGRA_NAMESPACE_END
+
+std::optional<TraceContext> TraceContext::parse(std::string_view traceparent) __tegra_noexcept
+{
+    //! version "-" trace-id "-" parent-id "-" trace-flags
+    if(traceparent.size() < 55 || traceparent[2] != '-' || traceparent[35] != '-' || traceparent[52] != '-') {
+        return std::nullopt;
+    }
+    //! Version ff is invalid; later versions may append fields after the flags.
+    const auto version = traceparent.substr(0, 2);
+    if(version == "ff" || (version == "00" && traceparent.size() != 55) || (traceparent.size() > 55 && traceparent[55] != '-')) {
+        return std::nullopt;
+    }
+    TraceContext res{};
+    std::array<u8, 1> flags{};
+    if(!fromHex(traceparent.substr(3, 32), res.traceId) || !fromHex(traceparent.substr(36, 16), res.spanId)) {
+        return std::nullopt;
+    }
+    //! Flags of zero are valid, unlike ids of zeros.
+    if(traceparent.substr(53, 2) != "00" && !fromHex(traceparent.substr(53, 2), flags)) {
+        return std::nullopt;
+    }
+    res.sampled = (flags[0] & 0x1) != 0;
+    return res;
+}
+
+std::string TraceContext::traceparent() const
+{
+    return "00-" + toHex(traceId) + "-" + toHex(spanId) + (sampled ? "-01" : "-00");
+}
+
+Span::Span(std::string_view name, const SpanKind kind) __tegra_noexcept
+{
+    const auto* parent = m_current;
+    if(parent == nullptr || !parent->m_recording) {
+        return;
+    }
+    m_context.traceId   = parent->m_context.traceId;
+    m_context.sampled   = true;
+    m_parent            = parent->m_context.spanId;
+    m_name              = name;
+    m_kind              = kind;
+    begin();
+}
+
+Span::Span(std::string_view name, std::string_view traceparent, const SpanKind kind) __tegra_noexcept
+{
+    if(!Tracer::enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if(const auto remote = TraceContext::parse(traceparent)) {
+        m_context.traceId   = remote->traceId;
+        m_context.sampled   = Tracer::followRemote.load(std::memory_order_relaxed) ? remote->sampled : sampledId(remote->traceId);
+        m_parent            = remote->spanId;
+    } else {
+        randomId(m_context.traceId);
+        m_context.sampled   = sampledId(m_context.traceId);
+    }
+    if(!m_context.sampled) {
+        return;
+    }
+    m_name = name;
+    m_kind = kind;
+    begin();
+}
+
+void Span::begin() __tegra_noexcept
+{
+    randomId(m_context.spanId);
+    m_recording = true;
+    m_start     = unixNanoseconds();
+    m_steady    = std::chrono::steady_clock::now();
+    m_previous  = m_current;
+    m_current   = this;
+}
+
+Span::~Span()
+{
+    if(!m_recording) {
+        return;
+    }
+    m_current = m_previous;
+    SpanData data{};
+    data.traceId    = m_context.traceId;
+    data.spanId     = m_context.spanId;
+    data.parentId   = m_parent;
+    data.name       = FROM_TEGRA_STRING(m_name);
+    data.kind       = m_kind;
+    data.start      = m_start;
+    data.end        = m_start + static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_steady).count());
+    data.attributes = std::move(m_attributes);
+    data.error      = std::move(m_error);
+    Tracer::submit(std::move(data));
+}
+
+bool Span::isRecording() const __tegra_noexcept
+{
+    return m_recording;
+}
+
+void Span::setAttribute(std::string_view key, std::string_view value)
+{
+    if(m_recording) {
+        m_attributes.emplace_back(FROM_TEGRA_STRING(key), FROM_TEGRA_STRING(value));
+    }
+}
+
+void Span::setAttribute(std::string_view key, s64 value)
+{
+    if(m_recording) {
+        m_attributes.emplace_back(FROM_TEGRA_STRING(key), value);
+    }
+}
+
+void Span::setError(std::string_view message)
+{
+    if(m_recording) {
+        m_error = message.empty() ? "error" : FROM_TEGRA_STRING(message);
+    }
+}
+
+const TraceContext& Span::context() const __tegra_noexcept
+{
+    return m_context;
+}
+
+Span* Span::current() __tegra_noexcept
+{
+    return m_current;
+}
+
+void Tracer::configure(const JSonData& section)
+{
+    if(section.isNull()) {
+        return;
+    }
+    if(section.isMember("sample_rate"))    sampleRate  = DBLCOMBINER(section, "sample_rate");
+    if(section.isMember("max_queue"))      maxQueue    = section["max_queue"].asUInt();
+    if(section.isMember("follow_remote"))  followRemote = BOOLCOMBINER(section, "follow_remote");
+    if(section.isMember("max_file_mb"))    maxFileSize = section["max_file_mb"].asUInt64() * 1024 * 1024;
+    if(section.isMember("max_files"))      maxFiles    = section["max_files"].asUInt();
+    const auto enable = section.isMember("enabled") && BOOLCOMBINER(section, "enabled");
+    if(enable) {
+        const auto file     = section.isMember("file") ? STRCOMBINER(section, "file") : FROM_TEGRA_STRING("server-log/traces.jsonl");
+        const auto service  = section.isMember("service") ? STRCOMBINER(section, "service") : FROM_TEGRA_STRING("tegra");
+        Exporter::start(file, service);
+    }
+    enabled = enable;
+}
+
+void Tracer::submit(SpanData&& span)
+{
+    if(auto* exporter = Exporter::get()) {
+        exporter->push(std::move(span));
+    }
+}
+
+void Tracer::flush()
+{
+    if(auto* exporter = Exporter::get()) {
+        exporter->flush();
+    }
+}
+
+void Tracer::shutdown()
+{
+    if(auto* exporter = Exporter::get()) {
+        exporter->shutdown();
+    }
+}
+
+u64 Tracer::dropped() __tegra_noexcept
+{
+    const auto* exporter = Exporter::get();
+    return exporter == nullptr ? __tegra_zero : exporter->dropped();
+}
+
+std::string Tracer::encode(const std::vector<SpanData>& spans, std::string_view service)
+{
+    std::string res{};
+    res.reserve(256 + spans.size() * 320);
+    res += R"({"resourceSpans":[{"resource":{"attributes":[{"key":"service.name","value":{"stringValue":")";
+    res += escape(service);
+    res += R"("}}]},"scopeSpans":[{"scope":{"name":"tegra"},"spans":[)";
+    bool first = true;
+    for(const auto& span : spans) {
+        if(!first) res += ',';
+        first = false;
+        res += fmt::format(R"({{"traceId":"{}","spanId":"{}",)", toHex(span.traceId), toHex(span.spanId));
+        if(!isZero(span.parentId)) {
+            res += fmt::format(R"("parentSpanId":"{}",)", toHex(span.parentId));
+        }
+        res += fmt::format(R"("name":"{}","kind":{},"startTimeUnixNano":"{}","endTimeUnixNano":"{}","attributes":[)",
+                           escape(span.name), static_cast<int>(span.kind), span.start, span.end);
+        for(std::size_t i = 0; i < span.attributes.size(); ++i) {
+            const auto& [key, value] = span.attributes[i];
+            if(i != 0) res += ',';
+            if(const auto* text = std::get_if<std::string>(&value)) {
+                res += fmt::format(R"({{"key":"{}","value":{{"stringValue":"{}"}}}})", escape(key), escape(*text));
+            } else {
+                //! OTLP/JSON encodes 64-bit integers as strings.
+                res += fmt::format(R"({{"key":"{}","value":{{"intValue":"{}"}}}})", escape(key), std::get<s64>(value));
+            }
+        }
+        res += ']';
+        if(!span.error.empty()) {
+            res += fmt::format(R"(,"status":{{"code":2,"message":"{}"}})", escape(span.error));
+        }
+        res += '}';
+    }
+    res += "]}]}]}";
+    return res;
+}
+
+TEGRA_NAMESPACE_END
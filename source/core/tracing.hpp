@@ -0,0 +1,190 @@
+/*!
+ * @file        tracing.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Sampled spans with W3C trace context propagation, exported in OTLP/JSON.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_TRACING_HPP
+#define TEGRA_TRACING_HPP
+
+//! Tegra's Common.
+#ifdef __has_include
+# if __has_include(<common>)
+#   include <common>
+#else
+#   error "Tegra's common was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::System)
+
+using TraceId           = std::array<u8, 16>;
+using SpanId            = std::array<u8, 8>;
+using SpanAttributes    = std::vector<std::pair<std::string, std::variant<std::string, s64>>>;
+
+/*!
+ * @brief The SpanKind enum holds the kinds of OTLP.
+ */
+__tegra_enum_class SpanKind : u8
+{
+    Internal    =   0x1,    ///<Work inside the process.
+    Server      =   0x2,    ///<Handling of an incoming request.
+    Client      =   0x3     ///<Call to another service, e.g. the database.
+};
+
+/*!
+ * @brief The TraceContext struct is the part of a span that crosses process boundaries in the traceparent header.
+ */
+struct TraceContext final
+{
+    TraceId traceId {};
+    SpanId  spanId  {};
+    bool    sampled { false };
+
+    /*!
+     * @brief parse function reads a traceparent header of version 00, e.g. "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01".
+     * @returns context or std::nullopt for a missing or malformed header.
+     */
+    __tegra_no_discard static std::optional<TraceContext> parse(std::string_view traceparent) __tegra_noexcept;
+
+    /*!
+     * @brief traceparent function returns the header value of the context.
+     */
+    __tegra_no_discard std::string traceparent() const;
+};
+
+/*!
+ * @brief The SpanData struct is a finished span waiting for the exporter.
+ */
+struct SpanData final
+{
+    TraceId         traceId     {};
+    SpanId          spanId      {};
+    SpanId          parentId    {};             ///< All zero for a root span.
+    std::string     name        {};
+    SpanKind        kind        { SpanKind::Internal };
+    u64             start       {};             ///< Nanoseconds since the Unix epoch.
+    u64             end         {};             ///< Nanoseconds since the Unix epoch.
+    SpanAttributes  attributes  {};
+    std::string     error       {};             ///< Status message; empty for a span that did not fail.
+};
+
+/*!
+ * @brief The Span class times a scope and becomes the current span of its thread while it lives.
+ * A span records only inside a sampled trace; otherwise it does not allocate, does not read the clock, and its setters do nothing.
+ * The name is kept as a view until the span ends, so it must outlive the span; literals do.
+ */
+class __tegra_export Span final
+{
+public:
+    /*!
+     * @brief Span constructor opens a child of the current span of the thread.
+     */
+    explicit Span(std::string_view name, const SpanKind kind = SpanKind::Internal) __tegra_noexcept;
+
+    /*!
+     * @brief Span constructor opens the span of an incoming request.
+     * @param traceparent is the header of the caller; without one, a new trace is started and sampled by Tracer::sampleRate.
+     * With Tracer::followRemote, a caller that sampled its trace has it sampled here as well, so a trace is never cut in the middle;
+     * without it, the trace of the caller is sampled by its id and Tracer::sampleRate, as a new one.
+     */
+    Span(std::string_view name, std::string_view traceparent, const SpanKind kind = SpanKind::Server) __tegra_noexcept;
+
+    ~Span();
+    TEGRA_DISABLE_COPY(Span)
+
+    /*!
+     * @brief isRecording checks if the span will be exported; build costly attributes only when it is.
+     */
+    __tegra_no_discard bool isRecording() const __tegra_noexcept;
+
+    void setAttribute(std::string_view key, std::string_view value);
+    void setAttribute(std::string_view key, s64 value);
+
+    /*!
+     * @brief setError function marks the span as failed.
+     */
+    void setError(std::string_view message);
+
+    /*!
+     * @brief context function returns the context to propagate, e.g. in an outgoing traceparent header.
+     */
+    __tegra_no_discard const TraceContext& context() const __tegra_noexcept;
+
+    /*!
+     * @brief current function returns the innermost span of the thread, or nullptr.
+     */
+    __tegra_no_discard static Span* current() __tegra_noexcept;
+
+private:
+    void begin() __tegra_noexcept;
+
+    TraceContext                                        m_context       {};
+    SpanId                                              m_parent        {};
+    std::string_view                                    m_name          {};
+    SpanKind                                            m_kind          { SpanKind::Internal };
+    bool                                                m_recording     { false };
+    u64                                                 m_start         {};
+    std::chrono::steady_clock::time_point               m_steady        {};
+    SpanAttributes                                      m_attributes    {};
+    std::string                                         m_error         {};
+    Span*                                               m_previous      { nullptr };
+
+    __tegra_inline_static thread_local Span*            m_current       { nullptr };
+};
+
+/*!
+ * @brief The Tracer class samples the traces and exports the finished spans from a background thread.
+ * Every batch is one OTLP/JSON ExportTraceServiceRequest per line of the trace file, the format read by the otlpjsonfile receiver of a collector.
+ * The file rotates like the logs: "traces.jsonl" is the newest, "traces.1.jsonl" to "traces.N.jsonl" the older ones.
+ */
+class __tegra_export Tracer final
+{
+public:
+    /*!
+     * @brief configure function reads the "tracing" section of the system config and starts the exporter when tracing is enabled.
+     */
+    static void configure(const JSonData& section);
+
+    /*!
+     * @brief submit function queues a finished span; when the queue is full the span is dropped.
+     */
+    static void submit(SpanData&& span);
+
+    /*!
+     * @brief flush function waits until the queued spans are written.
+     */
+    static void flush();
+
+    /*!
+     * @brief shutdown function writes the queued spans and stops the exporter.
+     */
+    static void shutdown();
+
+    /*!
+     * @brief dropped function returns the number of spans dropped because the queue was full.
+     */
+    __tegra_no_discard static u64 dropped() __tegra_noexcept;
+
+    /*!
+     * @brief encode function returns spans as an OTLP/JSON ExportTraceServiceRequest.
+     */
+    __tegra_no_discard static std::string encode(const std::vector<SpanData>& spans, std::string_view service);
+
+    __tegra_inline_static std::atomic<bool>     enabled     { false };  ///< Spans are recorded at all.
+    __tegra_inline_static std::atomic<double>   sampleRate  { 0.01 };   ///< Share of new traces that are sampled.
+    __tegra_inline_static std::atomic<u32>      maxQueue    { 4096 };   ///< Spans waiting for the exporter.
+    __tegra_inline_static std::atomic<bool>     followRemote { true };  ///< Sampled flag of the caller is followed; turn it off where any client can send a traceparent.
+    __tegra_inline_static std::atomic<u64>      maxFileSize { 64 * 1024 * 1024 };   ///< Bytes of the trace file after which it is rotated.
+    __tegra_inline_static std::atomic<u32>      maxFiles    { 4 };      ///< Rotated trace files kept beside the current one.
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_TRACING_HPP
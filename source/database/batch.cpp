@@ -0,0 +1,158 @@
+//! Tegra's Database Batch.
+#ifdef __has_include
+# if __has_include("batch.hpp")
+#   include "batch.hpp"
+#else
+#   error "Tegra's database batch was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+//! Bind parameters per statement: PostgreSQL accepts 65535, SQLite 32766.
+constexpr std::size_t MAX_BIND_PARAMETERS = 65535;
+constexpr std::size_t MAX_SQLITE_BIND_PARAMETERS = 32766;
+
+TEGRA_NAMESPACE_END
+
+BatchWriter::BatchWriter(const BatchInsert& target) : m_target(target)
+{
+    if(m_target.chunkSize == __tegra_zero) m_target.chunkSize = 1;
+    if(!m_target.columns.empty()) {
+        m_target.chunkSize = static_cast<u32>(std::min<std::size_t>(m_target.chunkSize, MAX_BIND_PARAMETERS / m_target.columns.size()));
+    }
+}
+
+BatchWriter::~BatchWriter()
+{
+}
+
+bool BatchWriter::add(const BatchRow& row)
+{
+    if(row.size() != m_target.columns.size()) {
+        if(DeveloperMode::IsEnable)
+            eLogger::Log("Batch row for [" + m_target.table + "] does not match its columns!", eLogger::LoggerType::Warning);
+        return false;
+    }
+    m_rows.push_back(row);
+    return true;
+}
+
+std::size_t BatchWriter::pending() const __tegra_noexcept
+{
+    return m_rows.size();
+}
+
+std::string BatchWriter::statement(std::size_t rows, Orm::ClientType type) const
+{
+    const bool positional = type != Orm::ClientType::PostgreSQL;
+    std::string sql { FROM_TEGRA_STRING(INSERT) + __tegra_space + INTO + __tegra_space + m_target.table + " (" };
+    for(std::size_t c = 0; c < m_target.columns.size(); ++c) {
+        if(c != 0) sql += ", ";
+        sql += m_target.columns[c];
+    }
+    sql += ") VALUES ";
+    std::size_t index{1};
+    sql.reserve(sql.size() + rows * m_target.columns.size() * 6);
+    for(std::size_t r = 0; r < rows; ++r) {
+        sql += r == 0 ? "(" : ", (";
+        for(std::size_t c = 0; c < m_target.columns.size(); ++c, ++index) {
+            if(c != 0) sql += ", ";
+            sql += positional ? "?" : "$" + TO_TEGRA_STRING(index);
+        }
+        sql += ")";
+    }
+    if(type != Orm::ClientType::Mysql) {
+        sql += " RETURNING " + m_target.key;
+    }
+    return sql;
+}
+
+BatchResult BatchWriter::flush()
+{
+    BatchResult res{};
+    if(m_rows.empty()) {
+        return res;
+    }
+    auto clientPtr = Router::writer();
+    const auto type = clientPtr->type();
+    res.ids.reserve(m_rows.size());
+    std::size_t written{}, chunk{m_target.chunkSize};
+    if(type == Orm::ClientType::Sqlite3 && !m_target.columns.empty()) {
+        chunk = std::min<std::size_t>(chunk, MAX_SQLITE_BIND_PARAMETERS / m_target.columns.size());
+    }
+    u64 increment {1};
+    if(type == Orm::ClientType::Mysql) {
+        //! Replication setups space the ids of every server apart, so the ids of a multi-row insert are not always consecutive.
+        try
+        {
+            for(const auto& row : clientPtr->execSqlSync("SELECT @@auto_increment_increment AS increment")) {
+                increment = std::max<u64>(1, row["increment"].as<u64>());
+            }
+        }
+        catch (const SqlException& e)
+        {
+            if(DeveloperMode::IsEnable)
+                eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+            res.success = false;
+            return res;
+        }
+    }
+    for(std::size_t from = 0; from < m_rows.size(); from += chunk) {
+        const auto rows = std::min<std::size_t>(chunk, m_rows.size() - from);
+        std::optional<SqlResult> result{};
+        std::string error{};
+        const auto sql = statement(rows, type);
+        Span span("db.batch", SpanKind::Client);
+        if(span.isRecording()) {
+            span.setAttribute("db.statement", QueryStatistics::normalize(sql));
+            span.setAttribute("db.rows", static_cast<s64>(rows));
+        }
+        const auto start = std::chrono::steady_clock::now();
+        {
+            //! Rows have a runtime arity, so they are bound one by one; the blocking binder executes when it goes out of scope.
+            auto binder = *clientPtr << sql;
+            for(std::size_t r = from; r < from + rows; ++r) {
+                for(const auto& value : m_rows[r]) {
+                    if(value.has_value()) binder << value.value();
+                    else binder << nullptr;
+                }
+            }
+            binder << Orm::Mode::Blocking;
+            binder >> [&result](const SqlResult& r) { result = r; };
+            binder >> [&error](const SqlException& e) { error = e.base().what(); };
+        }
+        ++res.statements;
+        const auto micros = static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        QueryStatistics::record(sql, micros, result.has_value() ? static_cast<u64>(result->affectedRows()) : __tegra_zero, !result.has_value(),
+                                QueryStatistics::isSlow(micros) ? TO_TEGRA_STRING(rows) + " rows x " + TO_TEGRA_STRING(m_target.columns.size()) + " columns" : __tegra_null_str);
+        if(!result.has_value()) {
+            span.setError(error);
+            if(DeveloperMode::IsEnable)
+                eLogger::Log("Database Error: " + error, eLogger::LoggerType::Critical);
+            res.success = false;
+            break;
+        }
+        if(type == Orm::ClientType::Mysql) {
+            const auto first = static_cast<u64>(result->insertId());
+            const auto count = static_cast<u64>(result->affectedRows());
+            for(u64 i = 0; i < count; ++i) res.ids.push_back(first + i * increment);
+            res.affected += count;
+        } else {
+            for(const auto& row : *result) res.ids.push_back(row[m_target.key].as<u64>());
+            res.affected += result->size();
+        }
+        written = from + rows;
+    }
+    //! Rows of a failed chunk stay pending, so the caller may retry the flush.
+    m_rows.erase(m_rows.begin(), m_rows.begin() + static_cast<std::ptrdiff_t>(written));
+    Query::invalidate(m_target.table);
+    return res;
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,105 @@
+/*!
+ * @file        batch.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Batched multi-row inserts that return the generated ids.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_BATCH_HPP
+#define TEGRA_DATABASE_BATCH_HPP
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include("core/database.hpp")
+#   include "core/database.hpp"
+#else
+#   error "Tegra's database was not found!"
+# endif
+#endif
+
+//! Tegra's Database Query.
+#ifdef __has_include
+# if __has_include("query.hpp")
+#   include "query.hpp"
+#else
+#   error "Tegra's database query was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+using BatchRow = std::vector<OptionalString>; ///< One record; std::nullopt is bound as NULL.
+
+/*!
+ * @brief The BatchInsert struct describes the target of a batch.
+ */
+struct BatchInsert final
+{
+    std::string     table       {};         ///< Full table name (with prefix).
+    VectorString    columns     {};         ///< Inserted columns, in the order of every row.
+    std::string     key         {"id"};     ///< Generated key column.
+    u32             chunkSize   {500};      ///< Maximum rows per statement.
+};
+
+/*!
+ * @brief The BatchResult struct holds the outcome of a flush.
+ */
+struct BatchResult final
+{
+    std::vector<u64>    ids         {};     ///< Generated ids in the order the rows were added.
+    u64                 affected    {};     ///< Number of inserted rows.
+    u32                 statements  {};     ///< Number of round trips.
+    bool                success     {true}; ///< False if a chunk failed.
+};
+
+/*!
+ * @brief The BatchWriter class collects rows and writes them with one multi-row INSERT per chunk.
+ * PostgreSQL and SQLite return the generated ids with RETURNING. On MySQL the ids are derived from LAST_INSERT_ID() and the number of inserted rows,
+ * which requires innodb_autoinc_lock_mode of 0 or 1 (consecutive) so a multi-row insert receives one contiguous range;
+ * the ids of the range are auto_increment_increment apart.
+ */
+class __tegra_export BatchWriter final
+{
+public:
+    explicit BatchWriter(const BatchInsert& target);
+    ~BatchWriter();
+
+    /*!
+     * @brief add function appends a row to the batch.
+     * @param row values must follow the order of the columns.
+     * @returns false if the row does not match the columns.
+     */
+    bool add(const BatchRow& row);
+
+    /*!
+     * @brief flush function writes all pending rows and clears the batch.
+     * @returns ids and counters of the write.
+     */
+    __tegra_no_discard BatchResult flush();
+
+    /*!
+     * @brief pending function returns the number of rows that are not written yet.
+     */
+    __tegra_no_discard std::size_t pending() const __tegra_noexcept;
+
+    /*!
+     * @brief statement function builds the INSERT statement of a chunk.
+     * @param rows is the number of rows of the chunk.
+     * @param type is the driver of the client.
+     * @returns the statement with placeholders.
+     */
+    __tegra_no_discard std::string statement(std::size_t rows, Orm::ClientType type) const;
+
+private:
+    BatchInsert             m_target    {};
+    std::vector<BatchRow>   m_rows      {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_BATCH_HPP
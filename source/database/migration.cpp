@@ -0,0 +1,414 @@
+//! Tegra's Database Migration.
+#ifdef __has_include
+# if __has_include("migration.hpp")
+#   include "migration.hpp"
+#else
+#   error "Tegra's database migration was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+MigrationStepType stepType(const std::string& type)
+{
+    if(type == "index")     return MigrationStepType::Index;
+    if(type == "column")    return MigrationStepType::Column;
+    if(type == "backfill")  return MigrationStepType::Backfill;
+    return MigrationStepType::Statement;
+}
+
+std::string joinColumns(const VectorString& columns)
+{
+    std::string res{};
+    for(const auto& c : columns) {
+        if(!res.empty()) res += ", ";
+        res += c;
+    }
+    return res;
+}
+
+TEGRA_NAMESPACE_END
+
+Migrator::Migrator(DriverTypes type) : m_type(type)
+{
+    m_prefix = FROM_TEGRA_STRING(CONFIG::SYSTEM_TABLES_PREFIX);
+    std::random_device device{};
+    m_owner = "node-" + TO_TEGRA_STRING((static_cast<u64>(device()) << 32) | device());
+}
+
+Migrator::~Migrator()
+{
+}
+
+void Migrator::add(const Migration& migration)
+{
+    if(migration.version == __tegra_zero) {
+        if(DeveloperMode::IsEnable)
+            eLogger::Log("Migration version 0 is reserved for the lock!", eLogger::LoggerType::Warning);
+        return;
+    }
+    if(m_migrations.contains(migration.version)) {
+        if(DeveloperMode::IsEnable)
+            eLogger::Log("Migration version " + TO_TEGRA_STRING(migration.version) + " is registered twice!", eLogger::LoggerType::Warning);
+        return;
+    }
+    m_migrations.insert_or_assign(migration.version, migration);
+}
+
+void Migrator::load()
+{
+    Scope<Configuration> config(new Configuration(ConfigType::File));
+    config->init(SectionType::Database);
+    if(!Configuration::GET["table_prefix"].asString().empty()) {
+        m_prefix = Configuration::GET["table_prefix"].asString();
+    }
+    for(const auto& m : Configuration::GET["migrations"]) {
+        Migration migration;
+        migration.version   = m["version"].asUInt64();
+        migration.name      = STRCOMBINER(m, "name");
+        for(const auto& s : m["steps"]) {
+            MigrationStep step;
+            step.type       = stepType(STRCOMBINER(s, "type"));
+            step.table      = STRCOMBINER(s, "table");
+            step.name       = STRCOMBINER(s, "name");
+            step.unique     = BOOLCOMBINER(s, "unique");
+            step.condition  = STRCOMBINER(s, "where");
+            for(const auto& c : s["columns"]) step.columns.push_back(c.asString());
+            if(s.isMember("key"))       step.key        = STRCOMBINER(s, "key");
+            if(s.isMember("batch"))     step.batchSize  = std::max(1u, s["batch"].asUInt());
+            if(s.isMember("throttle"))  step.throttle   = s["throttle"].asUInt();
+            //! Raw statements may be given per driver.
+            if(s.isMember("set"))               step.definition = STRCOMBINER(s, "set");
+            else if(s.isMember("definition"))   step.definition = STRCOMBINER(s, "definition");
+            else if(s.isMember("sql"))          step.definition = STRCOMBINER(s, "sql");
+            else if(m_type == DriverTypes::MySQL)       step.definition = STRCOMBINER(s, FROM_TEGRA_STRING(TEGRA_RDBMS::MySQL));
+            else if(m_type == DriverTypes::PostgreSQL)  step.definition = STRCOMBINER(s, FROM_TEGRA_STRING(TEGRA_RDBMS::PostgreSQL));
+            else if(m_type == DriverTypes::SQLite)      step.definition = STRCOMBINER(s, FROM_TEGRA_STRING(TEGRA_RDBMS::SQLite));
+            //! Raw statements and index names refer to tables as {{table_prefix}}name, like the seed statements.
+            step.definition = withPrefix(step.definition);
+            step.name       = withPrefix(step.name);
+            migration.steps.push_back(step);
+        }
+        add(migration);
+    }
+}
+
+std::string Migrator::withPrefix(std::string text) const
+{
+    constexpr std::string_view mark = "{{table_prefix}}";
+    for(auto at = text.find(mark); at != std::string::npos; at = text.find(mark, at + m_prefix.size())) {
+        text.replace(at, mark.size(), m_prefix);
+    }
+    return text;
+}
+
+std::string Migrator::table(const std::string& name) const
+{
+    return m_prefix + name;
+}
+
+std::string Migrator::migrationsTable() const
+{
+    return table(FROM_TEGRA_STRING(TEGRA_TABLES::SCHEMA_MIGRATIONS));
+}
+
+void Migrator::ensureTable()
+{
+    Router::writer()->execSqlSync(FROM_TEGRA_STRING(CREATE_TABLE) + " IF NOT EXISTS " + migrationsTable() +
+                                  " (version BIGINT NOT NULL, name VARCHAR(100) NOT NULL DEFAULT '',"
+                                  " applied_at TIMESTAMP NOT NULL DEFAULT CURRENT_TIMESTAMP, PRIMARY KEY (version))");
+}
+
+bool Migrator::hasTable()
+{
+    std::string statement{};
+    switch (m_type) {
+    case DriverTypes::PostgreSQL:
+        statement = "SELECT 1 FROM pg_catalog.pg_tables WHERE schemaname = current_schema() AND tablename = $1";
+        break;
+    case DriverTypes::MySQL:
+        statement = "SELECT 1 FROM information_schema.tables WHERE table_schema = DATABASE() AND table_name = ?";
+        break;
+    default:
+        statement = "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = ?";
+        break;
+    }
+    return !Router::writer()->execSqlSync(statement, migrationsTable()).empty();
+}
+
+u64 Migrator::currentVersion()
+{
+    u64 res{};
+    try
+    {
+        if(!hasTable()) {
+            return res;
+        }
+        for(const auto& row : Router::writer()->execSqlSync("SELECT COALESCE(MAX(version), 0) AS version FROM " + migrationsTable())) {
+            res = row["version"].as<u64>();
+        }
+    }
+    catch (const SqlException& e)
+    {
+        if(DeveloperMode::IsEnable) {
+            eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+        }
+    }
+    return res;
+}
+
+bool Migrator::isTransactional(const MigrationStep& step) const __tegra_noexcept
+{
+    //! MySQL commits implicitly on DDL, and concurrent index builds and batched backfills can not run in one transaction.
+    if(m_type == DriverTypes::SQLite) return step.type != MigrationStepType::Backfill;
+    if(m_type != DriverTypes::PostgreSQL) return false;
+    return step.type == MigrationStepType::Statement || step.type == MigrationStepType::Column;
+}
+
+VectorString Migrator::render(const MigrationStep& step) const
+{
+    VectorString res{};
+    const auto name = table(step.table);
+    switch (step.type) {
+    case MigrationStepType::Index:
+        if(m_type == DriverTypes::PostgreSQL) {
+            res.push_back(FROM_TEGRA_STRING("CREATE ") + (step.unique ? "UNIQUE " : "") + "INDEX CONCURRENTLY IF NOT EXISTS "
+                          + step.name + " ON " + name + " (" + joinColumns(step.columns) + ")");
+        } else if(m_type == DriverTypes::MySQL) {
+            res.push_back(FROM_TEGRA_STRING(ALTER_TABLE) + __tegra_space + "`" + name + "` ADD " + (step.unique ? "UNIQUE " : "")
+                          + "INDEX " + step.name + " (" + joinColumns(step.columns) + "), ALGORITHM=INPLACE, LOCK=NONE");
+        } else if(m_type == DriverTypes::SQLite) {
+            res.push_back(FROM_TEGRA_STRING("CREATE ") + (step.unique ? "UNIQUE " : "") + "INDEX IF NOT EXISTS "
+                          + step.name + " ON " + name + " (" + joinColumns(step.columns) + ")");
+        }
+        break;
+    case MigrationStepType::Column:
+        if(m_type == DriverTypes::PostgreSQL) {
+            //! A constant default is stored in the catalog, so the table is not rewritten.
+            res.push_back(FROM_TEGRA_STRING(ALTER_TABLE) + __tegra_space + name + " ADD COLUMN IF NOT EXISTS " + step.name + __tegra_space + step.definition);
+        } else if(m_type == DriverTypes::MySQL) {
+            res.push_back(FROM_TEGRA_STRING(ALTER_TABLE) + __tegra_space + "`" + name + "` ADD COLUMN " + step.name + __tegra_space + step.definition
+                          + ", ALGORITHM=INPLACE, LOCK=NONE");
+        } else if(m_type == DriverTypes::SQLite) {
+            res.push_back(FROM_TEGRA_STRING(ALTER_TABLE) + __tegra_space + name + " ADD COLUMN " + step.name + __tegra_space + step.definition);
+        }
+        break;
+    case MigrationStepType::Backfill: {
+        const auto placeholderLow   = m_type != DriverTypes::PostgreSQL ? "?" : "$1";
+        const auto placeholderHigh  = m_type != DriverTypes::PostgreSQL ? "?" : "$2";
+        res.push_back(FROM_TEGRA_STRING(UPDATE) + __tegra_space + name + " SET " + step.definition + __tegra_space + WHERE + __tegra_space
+                      + step.key + " >= " + placeholderLow + __tegra_space + AND + __tegra_space + step.key + " < " + placeholderHigh
+                      + (step.condition.empty() ? __tegra_null_str : FROM_TEGRA_STRING(" AND (") + step.condition + ")"));
+        break;
+    }
+    case MigrationStepType::Statement:
+    default:
+        if(!step.definition.empty()) res.push_back(step.definition);
+        break;
+    }
+    return res;
+}
+
+MigrationPlan Migrator::plan(std::optional<u64> target)
+{
+    MigrationPlan res{};
+    const auto current = currentVersion();
+    for(const auto& [version, migration] : m_migrations) {
+        if(version <= current) continue;
+        if(target.has_value() && version > target.value()) break;
+        for(const auto& step : migration.steps) {
+            for(const auto& s : render(step)) {
+                res.push_back({ version, step.type == MigrationStepType::Backfill
+                                ? s + " -- batches of " + TO_TEGRA_STRING(step.batchSize) + " rows, " + TO_TEGRA_STRING(step.throttle) + " ms apart"
+                                : s, isTransactional(step) });
+            }
+        }
+    }
+    return res;
+}
+
+void Migrator::dropInvalidIndex(const Orm::DbClientPtr& client, const MigrationStep& step)
+{
+    //! A build can outlast the lease, so the node that lost it may still run one; its index stays invalid until the build ends.
+    const auto building = "SELECT 1 FROM pg_stat_progress_create_index p INNER JOIN pg_class c ON c.oid = p.index_relid WHERE c.relname = $1";
+    while(!client->execSqlSync(building, step.name).empty()) {
+        renew(client);
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+    //! A failed concurrent build leaves an invalid index behind, which IF NOT EXISTS would keep forever.
+    auto result = client->execSqlSync("SELECT 1 FROM pg_class c INNER JOIN pg_index i ON i.indexrelid = c.oid "
+                                      "WHERE c.relname = $1 AND NOT i.indisvalid", step.name);
+    if(!result.empty()) {
+        client->execSqlSync("DROP INDEX CONCURRENTLY IF EXISTS " + step.name);
+    }
+}
+
+void Migrator::runBackfill(const Orm::DbClientPtr& client, const MigrationStep& step)
+{
+    s64 low{}, high{};
+    for(const auto& row : client->execSqlSync("SELECT COALESCE(MIN(" + step.key + "), 0) AS low, COALESCE(MAX(" + step.key + "), -1) AS high FROM " + table(step.table))) {
+        low  = row["low"].as<s64>();
+        high = row["high"].as<s64>();
+    }
+    const auto statement = render(step).front();
+    //! Each batch is its own short transaction over a primary key range, so row locks are held only for one batch.
+    for(auto from = low; from <= high; from += step.batchSize) {
+        client->execSqlSync(statement, from, from + static_cast<s64>(step.batchSize));
+        renew(client);
+        if(step.throttle != __tegra_zero) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(step.throttle));
+        }
+    }
+}
+
+bool Migrator::apply(const Orm::DbClientPtr& clientPtr, std::optional<u64> target)
+{
+    const auto current = currentVersion();
+    for(const auto& [version, migration] : m_migrations) {
+        if(version <= current) continue;
+        if(target.has_value() && version > target.value()) break;
+        try
+        {
+            renew(clientPtr);
+            const bool transactional = std::all_of(migration.steps.begin(), migration.steps.end(),
+                                                   [this](const MigrationStep& s) { return isTransactional(s); });
+            const auto record = "INSERT INTO " + migrationsTable() + " (version, name) VALUES (" + Query::placeholder(1) + ", " + Query::placeholder(2) + ")";
+            if(transactional) {
+                //! The transaction commits when it goes out of scope.
+                auto transaction = clientPtr->newTransaction();
+                for(const auto& step : migration.steps) {
+                    for(const auto& s : render(step)) transaction->execSqlSync(s);
+                }
+                transaction->execSqlSync(record, version, migration.name);
+            } else {
+                for(const auto& step : migration.steps) {
+                    if(step.type == MigrationStepType::Backfill) {
+                        runBackfill(clientPtr, step);
+                        continue;
+                    }
+                    if(step.type == MigrationStepType::Index && m_type == DriverTypes::PostgreSQL) {
+                        dropInvalidIndex(clientPtr, step);
+                    }
+                    for(const auto& s : render(step)) clientPtr->execSqlSync(s);
+                }
+                //! The node whose build was waited for may have recorded the migration meanwhile.
+                if(clientPtr->execSqlSync("SELECT 1 FROM " + migrationsTable() + " WHERE version = " + Query::placeholder(1), version).empty()) {
+                    clientPtr->execSqlSync(record, version, migration.name);
+                }
+            }
+            for(const auto& step : migration.steps) {
+                Query::invalidate(table(step.table));
+            }
+            if(DeveloperMode::IsEnable)
+                eLogger::Log("Migration " + TO_TEGRA_STRING(version) + " [" + migration.name + "] has been applied.", eLogger::LoggerType::Success);
+        }
+        catch (const SqlException& e)
+        {
+            if(DeveloperMode::IsEnable) {
+                eLogger::Log("Migration " + TO_TEGRA_STRING(version) + " failed: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string Migrator::leaseExpired() const
+{
+    const auto seconds = TO_TEGRA_STRING(LEASE_SECONDS);
+    switch (m_type) {
+    case DriverTypes::PostgreSQL:
+        return "applied_at < LOCALTIMESTAMP - INTERVAL '" + seconds + " seconds'";
+    case DriverTypes::MySQL:
+        return "applied_at < CURRENT_TIMESTAMP - INTERVAL " + seconds + " SECOND";
+    default:
+        return "applied_at < datetime('now', '-" + seconds + " seconds')";
+    }
+}
+
+bool Migrator::lock(const Orm::DbClientPtr& client)
+{
+    const auto insert = "INSERT INTO " + migrationsTable() + " (version, name) VALUES (0, " + Query::placeholder(1) + ")";
+    const auto expire = "DELETE FROM " + migrationsTable() + " WHERE version = 0 AND " + leaseExpired();
+    const auto holder = "SELECT name FROM " + migrationsTable() + " WHERE version = 0";
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(LOCK_WAIT_SECONDS);
+    bool released {false};
+    while(true) {
+        std::string owner{};
+        try
+        {
+            client->execSqlSync(insert, m_owner);
+            return true;
+        }
+        catch (const SqlException&)
+        {
+            //! Only the lease row makes the insert fail on purpose; any other error is thrown, unless the lease was released just now.
+            for(const auto& row : client->execSqlSync(holder)) owner = row["name"].as<std::string>();
+            if(owner.empty()) {
+                if(released) throw;
+                released = true;
+                continue;
+            }
+            released = false;
+        }
+        if(std::chrono::steady_clock::now() >= deadline) {
+            eLogger::Log("Migration lease is held by " + owner + ", gave up after " + TO_TEGRA_STRING(LOCK_WAIT_SECONDS) + " seconds.",
+                         eLogger::LoggerType::Critical);
+            return false;
+        }
+        //! A node that stopped renewing the lease has crashed, so its lease is taken over.
+        client->execSqlSync(expire);
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+}
+
+void Migrator::renew(const Orm::DbClientPtr& client)
+{
+    client->execSqlSync("UPDATE " + migrationsTable() + " SET applied_at = CURRENT_TIMESTAMP WHERE version = 0 AND name = " + Query::placeholder(1), m_owner);
+}
+
+void Migrator::unlock(const Orm::DbClientPtr& client)
+{
+    try
+    {
+        client->execSqlSync("DELETE FROM " + migrationsTable() + " WHERE version = 0 AND name = " + Query::placeholder(1), m_owner);
+    }
+    catch (const SqlException& e)
+    {
+        if(DeveloperMode::IsEnable) {
+            eLogger::Log("Migration unlock failed: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+        }
+    }
+}
+
+bool Migrator::migrate(std::optional<u64> target)
+{
+    if(m_migrations.empty()) {
+        return true;
+    }
+    auto clientPtr = Router::writer();
+    try
+    {
+        ensureTable();
+        if(!lock(clientPtr)) {
+            return false;
+        }
+    }
+    catch (const SqlException& e)
+    {
+        if(DeveloperMode::IsEnable) {
+            eLogger::Log("Migration lock failed: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+        }
+        return false;
+    }
+    const auto res = apply(clientPtr, target);
+    unlock(clientPtr);
+    return res;
+}
+
+TEGRA_NAMESPACE_END
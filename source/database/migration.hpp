@@ -0,0 +1,174 @@
+/*!
+ * @file        migration.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Versioned online schema migrations.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_MIGRATION_HPP
+#define TEGRA_DATABASE_MIGRATION_HPP
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include("core/database.hpp")
+#   include "core/database.hpp"
+#else
+#   error "Tegra's database was not found!"
+# endif
+#endif
+
+//! Tegra's Database Query.
+#ifdef __has_include
+# if __has_include("query.hpp")
+#   include "query.hpp"
+#else
+#   error "Tegra's database query was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+/*!
+ * @brief Type of a migration step; each type is rendered with the least locking form of the driver.
+ */
+enum class MigrationStepType : u8
+{
+    Statement   = 0x0, ///<Plain statement, executed as is.
+    Index       = 0x1, ///<CREATE INDEX CONCURRENTLY (PostgreSQL) or ALGORITHM=INPLACE, LOCK=NONE (MySQL).
+    Column      = 0x2, ///<ADD COLUMN without table rewrite where the driver allows it.
+    Backfill    = 0x3  ///<Batched UPDATE over primary key ranges with a pause between batches.
+};
+
+/*!
+ * @brief The MigrationStep struct describes one step of a migration.
+ * @example {"type":"index", "table":"members", "name":"members_email_idx", "columns":["email"]}
+ * @example {"type":"backfill", "table":"likes", "key":"id", "set":"score = 1", "where":"score IS NULL", "batch":5000, "throttle":20}
+ * @example {"type":"statement", "postgresql":"CREATE TABLE IF NOT EXISTS {{table_prefix}}cache (...)", "mysql":"...", "sqlite3":"..."}
+ */
+struct MigrationStep final
+{
+    MigrationStepType   type        {};         ///< Type of the step.
+    std::string         table       {};         ///< Table name without prefix.
+    std::string         name        {};         ///< Index or column name.
+    VectorString        columns     {};         ///< Indexed columns.
+    bool                unique      {};         ///< Unique index.
+    std::string         definition  {};         ///< Column definition, SET clause of a backfill or the raw statement.
+    std::string         condition   {};         ///< Optional WHERE condition of a backfill.
+    std::string         key         {"id"};     ///< Numeric primary key walked by a backfill.
+    u32                 batchSize   {1000};     ///< Rows per backfill batch.
+    u32                 throttle    {};         ///< Pause between backfill batches in milliseconds.
+};
+
+/*!
+ * @brief The Migration struct is one schema version.
+ */
+struct Migration final
+{
+    u64                         version {};     ///< Strictly increasing version number above 0; an applied version is never reused, so gaps are kept.
+    std::string                 name    {};     ///< Short name of the migration.
+    std::vector<MigrationStep>  steps   {};     ///< Ordered steps.
+};
+
+/*!
+ * @brief The PlannedStatement struct is one entry of a dry-run plan.
+ */
+struct PlannedStatement final
+{
+    u64             version         {};     ///< Version of the migration.
+    std::string     statement       {};     ///< Statement that will be executed.
+    bool            transactional   {};     ///< Statement runs inside the migration transaction.
+};
+
+using MigrationPlan = std::vector<PlannedStatement>;
+
+/*!
+ * @brief The Migrator class applies pending migrations in version order and records them in the schema_migrations table.
+ * Steps must be idempotent where the driver allows it, since a migration that fails halfway is retried from its first step.
+ */
+class __tegra_export Migrator final
+{
+public:
+    explicit Migrator(DriverTypes type);
+    ~Migrator();
+
+    /*!
+     * @brief add function registers a migration.
+     * @param migration is the migration.
+     */
+    void add(const Migration& migration);
+
+    /*!
+     * @brief load function registers the migrations of the "migrations" section of system-database.json.
+     */
+    void load();
+
+    /*!
+     * @brief currentVersion function returns the last applied version; it only reads, so a missing schema_migrations table is not created.
+     * @returns zero when no migration has been applied.
+     */
+    __tegra_no_discard u64 currentVersion();
+
+    /*!
+     * @brief plan function returns the statements of all pending migrations without executing anything.
+     * @param target is the last version to apply, all pending migrations by default.
+     * @returns dry-run plan.
+     */
+    __tegra_no_discard MigrationPlan plan(std::optional<u64> target = std::nullopt);
+
+    /*!
+     * @brief migrate function applies all pending migrations up to the target version.
+     * Nodes that start together take turns on a lease, the row of version 0 in schema_migrations, and each one reads
+     * the applied version only once it holds the lease, so a migration runs once. The lease is renewed between migrations
+     * and backfill batches; one that was not renewed for LEASE_SECONDS belongs to a crashed node and is taken over.
+     * An index build can outlast the lease, so a node waits for a build of the same index that is still running before it
+     * drops an invalid one. A node that does not get the lease within LOCK_WAIT_SECONDS logs its holder and gives up.
+     * @param target is the last version to apply, all pending migrations by default.
+     * @returns true if every migration has been applied.
+     */
+    bool migrate(std::optional<u64> target = std::nullopt);
+
+    __tegra_inline_static_constexpr u32 LEASE_SECONDS = 300;
+
+    //! Seconds a node waits for the lease of another one before migrate gives up.
+    __tegra_inline_static_constexpr u32 LOCK_WAIT_SECONDS = 2 * LEASE_SECONDS;
+
+    /*!
+     * @brief render function turns a step into the statements of the driver.
+     * @param step is the migration step.
+     * @returns statements; a backfill is rendered as the statement of one batch.
+     */
+    __tegra_no_discard VectorString render(const MigrationStep& step) const;
+
+    /*!
+     * @brief isTransactional checks if a step can run inside a transaction.
+     */
+    __tegra_no_discard bool isTransactional(const MigrationStep& step) const __tegra_noexcept;
+
+private:
+    void ensureTable();
+    __tegra_no_discard bool hasTable();
+    __tegra_no_discard bool apply(const Orm::DbClientPtr& client, std::optional<u64> target);
+    __tegra_no_discard bool lock(const Orm::DbClientPtr& client);
+    void renew(const Orm::DbClientPtr& client);
+    void unlock(const Orm::DbClientPtr& client);
+    __tegra_no_discard std::string leaseExpired() const;
+    void runBackfill(const Orm::DbClientPtr& client, const MigrationStep& step);
+    void dropInvalidIndex(const Orm::DbClientPtr& client, const MigrationStep& step);
+    __tegra_no_discard std::string table(const std::string& name) const;
+    __tegra_no_discard std::string withPrefix(std::string text) const;
+    __tegra_no_discard std::string migrationsTable() const;
+
+    DriverTypes                     m_type          {};
+    std::string                     m_prefix        {};
+    std::map<u64, Migration>        m_migrations    {};
+    std::string                     m_owner         {};     ///< Name of this node in the lease.
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_MIGRATION_HPP
@@ -0,0 +1,195 @@
+//! Tegra's Database Pager.
+#ifdef __has_include
+# if __has_include("pager.hpp")
+#   include "pager.hpp"
+#else
+#   error "Tegra's database pager was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+constexpr char CURSOR_SEPARATOR = '|';
+
+//! Marks the sort value of a cursor, so a NULL is not mistaken for an empty string.
+constexpr char CURSOR_VALUE = 'v';
+constexpr char CURSOR_NULL  = 'n';
+
+TEGRA_NAMESPACE_END
+
+std::string KeysetPager::qualify(const std::string& column)
+{
+    return column.find('.') == std::string::npos ? "k." + column : column;
+}
+
+std::string KeysetPager::unqualify(const std::string& column)
+{
+    const auto dot = column.rfind('.');
+    return dot == std::string::npos ? column : column.substr(dot + 1);
+}
+
+std::string KeysetPager::fingerprint(const KeysetQuery& query)
+{
+    const auto hash = std::hash<std::string>{}(query.table + CURSOR_SEPARATOR + query.valueTable + CURSOR_SEPARATOR + query.key + CURSOR_SEPARATOR
+                                               + query.sortKey + CURSOR_SEPARATOR + TO_TEGRA_STRING(static_cast<int>(query.order)) + CURSOR_SEPARATOR
+                                               + query.language + CURSOR_SEPARATOR + query.condition + CURSOR_SEPARATOR
+                                               + TO_TEGRA_STRING(query.nullable));
+    std::ostringstream stream{};
+    stream << std::hex << hash;
+    return stream.str();
+}
+
+std::string KeysetPager::statementId(const KeysetQuery& query, const std::optional<KeysetCursor>& position)
+{
+    //! The cursor does not depend on the page size or the columns, but the prepared statement does.
+    std::ostringstream stream{};
+    stream << std::hex << std::hash<std::string>{}(query.columns);
+    auto res = "keyset." + fingerprint(query) + "." + stream.str() + "." + TO_TEGRA_STRING(std::max<u32>(1, query.limit));
+    if(position.has_value()) res += position->null ? ".seek_null" : ".seek";
+    return res;
+}
+
+std::string KeysetPager::statement(const KeysetQuery& query, const std::optional<KeysetCursor>& position, Orm::ClientType type)
+{
+    const bool positional = type != Orm::ClientType::PostgreSQL;
+    u32 index{};
+    auto placeholder = [&]() { ++index; return positional ? FROM_TEGRA_STRING("?") : "$" + TO_TEGRA_STRING(index); };
+
+    const auto key = qualify(query.key);
+    const auto direction = query.order == SortOrder::Descending ? " DESC" : " ASC";
+
+    std::string sql { FROM_TEGRA_STRING(SELECT) + __tegra_space + query.columns + __tegra_space + FROM + __tegra_space + query.table + " AS k" };
+    VectorString where{};
+    if(!query.valueTable.empty()) {
+        sql += FROM_TEGRA_STRING(__tegra_space) + INNER_JOIN + __tegra_space + query.valueTable + " AS v ON v." + unqualify(query.key) + " = " + key;
+        if(!query.language.empty()) {
+            //! The language is part of the join, so (language, id) on the value table serves both filter and join.
+            sql += " AND v.language = " + placeholder();
+        }
+    }
+    if(!query.condition.empty()) {
+        where.push_back("(" + query.condition + ")");
+    }
+    const auto sortKey = qualify(query.sortKey);
+    const bool nullable = query.nullable && !query.sortKey.empty();
+    if(position.has_value()) {
+        const auto op = query.order == SortOrder::Descending ? " < " : " > ";
+        if(query.sortKey.empty()) {
+            where.push_back(key + op + placeholder());
+        } else if(position->null) {
+            //! NULLs come last, so only the rest of the NULLs follow a NULL position.
+            where.push_back(sortKey + " IS NULL AND " + key + op + placeholder());
+        } else {
+            const auto sortValue = placeholder();
+            const auto seek = "(" + sortKey + ", " + key + ")" + op + "(" + sortValue + ", " + placeholder() + ")";
+            where.push_back(nullable ? "(" + seek + " OR " + sortKey + " IS NULL)" : seek);
+        }
+    }
+    for(std::size_t i = 0; i < where.size(); ++i) {
+        sql += (i == 0 ? " WHERE " : " AND ") + where[i];
+    }
+    sql += " ORDER BY ";
+    if(nullable) {
+        //! Drivers disagree on where NULLs sort, so the order is spelled out.
+        sql += "(" + sortKey + " IS NULL) ASC, ";
+    }
+    if(!query.sortKey.empty()) {
+        sql += sortKey + direction + ", ";
+    }
+    sql += key + direction + " LIMIT " + TO_TEGRA_STRING(std::max<u32>(1, query.limit));
+    return sql;
+}
+
+std::string KeysetPager::encode(const KeysetQuery& query, const KeysetCursor& cursor)
+{
+    //! The sort value goes last, so it may contain the separator.
+    const auto raw = fingerprint(query) + CURSOR_SEPARATOR + TO_TEGRA_STRING(cursor.id) + CURSOR_SEPARATOR
+                     + (cursor.null ? CURSOR_NULL : CURSOR_VALUE) + cursor.sortValue;
+    return Framework::utils::base64Encode(reinterpret_cast<const unsigned char*>(raw.data()), raw.size(), true, false);
+}
+
+std::optional<KeysetCursor> KeysetPager::decode(const KeysetQuery& query, const std::string& cursor)
+{
+    const auto raw = Framework::utils::base64Decode(cursor);
+    const auto first = raw.find(CURSOR_SEPARATOR);
+    if(first == std::string::npos || raw.substr(0, first) != fingerprint(query)) {
+        return std::nullopt;
+    }
+    const auto second = raw.find(CURSOR_SEPARATOR, first + 1);
+    if(second == std::string::npos || second + 1 == raw.size()) {
+        return std::nullopt;
+    }
+    KeysetCursor res{};
+    const auto id = std::string_view(raw).substr(first + 1, second - first - 1);
+    if(std::from_chars(id.data(), id.data() + id.size(), res.id).ec != std::errc()) {
+        return std::nullopt;
+    }
+    const auto marker = raw[second + 1];
+    if(marker == CURSOR_NULL && query.nullable) {
+        res.null = true;
+    } else if(marker == CURSOR_VALUE) {
+        res.sortValue = raw.substr(second + 2);
+    } else {
+        return std::nullopt;
+    }
+    return res;
+}
+
+KeysetPage KeysetPager::fetch(const KeysetQuery& query, const OptionalString& cursor)
+{
+    KeysetPage res{};
+    std::optional<KeysetCursor> position{};
+    if(cursor.has_value()) {
+        position = decode(query, cursor.value());
+        if(!position.has_value()) {
+            if(DeveloperMode::IsEnable)
+                eLogger::Log("Invalid keyset cursor for [" + query.table + "]!", eLogger::LoggerType::Warning);
+            return res;
+        }
+    }
+    auto clientPtr = Router::reader();
+    const bool seek = position.has_value();
+    const bool language = !query.valueTable.empty() && !query.language.empty();
+    const bool sorted = !query.sortKey.empty() && !(seek && position->null);
+
+    Statement statement{};
+    statement.id        = statementId(query, position);
+    statement.sql       = KeysetPager::statement(query, position, clientPtr->type());
+    statement.tables    = { query.table };
+    statement.cacheable = query.cacheable;
+    if(!query.valueTable.empty()) statement.tables.push_back(query.valueTable);
+
+    if(language && seek && sorted)      res.rows = Query::select(statement, query.language, position->sortValue, position->id);
+    else if(language && seek)           res.rows = Query::select(statement, query.language, position->id);
+    else if(language)                   res.rows = Query::select(statement, query.language);
+    else if(seek && sorted)             res.rows = Query::select(statement, position->sortValue, position->id);
+    else if(seek)                       res.rows = Query::select(statement, position->id);
+    else                                res.rows = Query::select(statement);
+
+    //! A full page may be followed by more rows; the last one becomes the next position.
+    if(res.rows->size() == std::max<u32>(1, query.limit)) {
+        const auto last = (*res.rows)[res.rows->size() - 1];
+        KeysetCursor next{};
+        next.id = last[unqualify(query.key)].as<u64>();
+        if(!query.sortKey.empty()) {
+            const auto field = last[unqualify(query.sortKey)];
+            if(field.isNull() && !query.nullable) {
+                //! An empty position would restart the listing, so paging stops here instead.
+                if(DeveloperMode::IsEnable)
+                    eLogger::Log("NULL sort key [" + query.sortKey + "] in [" + query.table + "], the listing must be nullable!", eLogger::LoggerType::Critical);
+                return res;
+            }
+            next.null = field.isNull();
+            if(!next.null) next.sortValue = field.as<std::string>();
+        }
+        res.next = encode(query, next);
+    }
+    return res;
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,125 @@
+/*!
+ * @file        pager.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Keyset (seek) pagination over (sort key, id) tuples.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_PAGER_HPP
+#define TEGRA_DATABASE_PAGER_HPP
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include("core/database.hpp")
+#   include "core/database.hpp"
+#else
+#   error "Tegra's database was not found!"
+# endif
+#endif
+
+//! Tegra's Database Query.
+#ifdef __has_include
+# if __has_include("query.hpp")
+#   include "query.hpp"
+#else
+#   error "Tegra's database query was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+enum class SortOrder : u8
+{
+    Ascending   = 0x0, ///<Oldest or smallest first.
+    Descending  = 0x1  ///<Newest or largest first.
+};
+
+/*!
+ * @brief The KeysetQuery struct describes a listing.
+ * The key table is aliased as k and the value (_l) table as v, so sort keys and conditions may use either alias.
+ * @example KeysetQuery { .table = "teg_posts", .sortKey = "k.created_at", .order = SortOrder::Descending, .valueTable = "teg_posts_l", .language = "en" }
+ */
+struct KeysetQuery final
+{
+    std::string     table       {};                     ///< Key table (with prefix).
+    std::string     key         {"id"};                 ///< Unique numeric key that breaks ties of the sort key.
+    std::string     sortKey     {};                     ///< Sort column, the key alone is used when empty.
+    bool            nullable    {false};                ///< Sort column may be NULL; NULLs are listed last, at the cost of the index order.
+    SortOrder       order       {SortOrder::Ascending}; ///< Direction of the listing.
+    std::string     columns     {"*"};                  ///< Selected columns.
+    std::string     valueTable  {};                     ///< Optional value (_l) table joined on the key.
+    std::string     language    {};                     ///< Language of the value table rows.
+    std::string     condition   {};                     ///< Additional constant filter.
+    u32             limit       {20};                   ///< Rows per page.
+    bool            cacheable   {false};                ///< Pages may be served from the query cache.
+};
+
+/*!
+ * @brief The KeysetCursor struct is the decoded position after the last row of a page.
+ */
+struct KeysetCursor final
+{
+    std::string     sortValue   {}; ///< Sort key of the last row.
+    bool            null        {}; ///< Sort key of the last row is NULL.
+    u64             id          {}; ///< Key of the last row.
+};
+
+/*!
+ * @brief The KeysetPage struct is one page of a listing.
+ */
+struct KeysetPage final
+{
+    std::optional<SqlResult>    rows    {}; ///< Rows of the page.
+    OptionalString              next    {}; ///< Opaque cursor of the next page, empty on the last page.
+};
+
+/*!
+ * @brief The KeysetPager class generates seek predicates, so every page is an index range scan no matter how deep it is.
+ * Cursors are opaque and bound to the listing (table, sort, order and language) they were produced for.
+ */
+class __tegra_export KeysetPager final
+{
+public:
+    /*!
+     * @brief fetch function reads one page of a listing.
+     * @param query is the listing.
+     * @param cursor is the cursor of the previous page, or nothing for the first page.
+     * @returns rows and the cursor of the next page.
+     */
+    __tegra_no_discard static KeysetPage fetch(const KeysetQuery& query, const OptionalString& cursor = std::nullopt);
+
+    /*!
+     * @brief statement function generates the statement of a page.
+     * @param query is the listing.
+     * @param position adds the cursor predicate.
+     * @param type is the driver of the client.
+     * @returns statement; parameters are the language (if any), then the sort value (if any and not NULL) and the key.
+     */
+    __tegra_no_discard static std::string statement(const KeysetQuery& query, const std::optional<KeysetCursor>& position, Orm::ClientType type);
+
+    /*!
+     * @brief encode function turns a position into an opaque cursor.
+     */
+    __tegra_no_discard static std::string encode(const KeysetQuery& query, const KeysetCursor& cursor);
+
+    /*!
+     * @brief decode function restores a position from an opaque cursor.
+     * @returns nothing if the cursor is malformed or belongs to another listing.
+     */
+    __tegra_no_discard static std::optional<KeysetCursor> decode(const KeysetQuery& query, const std::string& cursor);
+
+private:
+    __tegra_no_discard static std::string fingerprint(const KeysetQuery& query);
+    __tegra_no_discard static std::string statementId(const KeysetQuery& query, const std::optional<KeysetCursor>& position);
+    __tegra_no_discard static std::string qualify(const std::string& column);
+    __tegra_no_discard static std::string unqualify(const std::string& column);
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_PAGER_HPP
@@ -0,0 +1,289 @@
+//! Tegra's Database Projection.
+#ifdef __has_include
+# if __has_include("projection.hpp")
+#   include "projection.hpp"
+#else
+#   error "Tegra's database projection was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+std::size_t ProjectionSnapshot::size() const __tegra_noexcept
+{
+    return m_values.empty() ? __tegra_zero : m_values.front().size();
+}
+
+const VectorString& ProjectionSnapshot::columns() const __tegra_noexcept
+{
+    return m_columns;
+}
+
+std::optional<std::size_t> ProjectionSnapshot::column(std::string_view name) const
+{
+    for(std::size_t i = 0; i < m_columns.size(); ++i) {
+        if(m_columns[i] == name) return i;
+    }
+    return std::nullopt;
+}
+
+std::optional<std::size_t> ProjectionSnapshot::find(u64 id) const
+{
+    auto it = m_rows.find(id);
+    if(it == m_rows.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::string_view ProjectionSnapshot::value(std::size_t row, std::string_view column) const
+{
+    const auto index = this->column(column);
+    if(!index.has_value() || row >= size()) {
+        return {};
+    }
+    return m_values[index.value()][row];
+}
+
+const VectorString& ProjectionSnapshot::values(std::string_view column) const
+{
+    static const VectorString empty{};
+    const auto index = this->column(column);
+    return index.has_value() ? m_values[index.value()] : empty;
+}
+
+void Projection::configure(ProjectionMode mode, const VectorString& tables, const std::string& prefix, const std::string& suffix)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_prefix = prefix;
+    m_suffix = suffix;
+    for(const auto& t : tables) {
+        if(m_pairs.contains(t)) continue;
+        auto pair   = CreateScope<Pair>();
+        pair->key   = prefix + t;
+        pair->value = prefix + t + suffix;
+        pair->view  = prefix + t + "_mv";
+        m_tables.insert_or_assign(pair->key, pair.get());
+        m_tables.insert_or_assign(pair->value, pair.get());
+        m_pairs.insert_or_assign(t, std::move(pair));
+    }
+    m_slots.clear();
+    m_mode.store(mode, std::memory_order_release);
+}
+
+ProjectionMode Projection::mode() __tegra_noexcept
+{
+    const auto res = m_mode.load(std::memory_order_acquire);
+    if(res == ProjectionMode::MaterializedView) {
+        //! Materialized views are PostgreSQL only; other drivers keep the snapshots in memory.
+        auto clientPtr = Router::writer();
+        if(isNullPtr(clientPtr) || clientPtr->type() != Orm::ClientType::PostgreSQL) {
+            return ProjectionMode::Memory;
+        }
+    }
+    return res;
+}
+
+bool Projection::isProjected(const std::string& table)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_pairs.contains(table);
+}
+
+Projection::Pair* Projection::pairOf(const std::string& table)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_pairs.find(table);
+    return it == m_pairs.end() ? nullptr : it->second.get();
+}
+
+std::string Projection::join(const std::string& key, const std::string& value)
+{
+    //! USING merges the two id columns, so SELECT * has one id.
+    return key + __tegra_space + INNER_JOIN + __tegra_space + value + " USING (id)";
+}
+
+std::string Projection::relation(const std::string& table)
+{
+    auto pair = pairOf(table);
+    if(pair == nullptr) {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return join(m_prefix + table, m_prefix + table + m_suffix);
+    }
+    if(mode() == ProjectionMode::MaterializedView && ensureView(*pair)) {
+        return pair->view;
+    }
+    return join(pair->key, pair->value);
+}
+
+bool Projection::ensureView(Pair& pair)
+{
+    if(pair.viewReady.load(std::memory_order_acquire)) {
+        return true;
+    }
+    try
+    {
+        auto clientPtr = Router::writer();
+        clientPtr->execSqlSync("CREATE MATERIALIZED VIEW IF NOT EXISTS " + pair.view + " AS SELECT * FROM " + join(pair.key, pair.value));
+        //! REFRESH ... CONCURRENTLY needs a unique index, and it keeps the view readable while it is rebuilt.
+        clientPtr->execSqlSync("CREATE UNIQUE INDEX IF NOT EXISTS " + pair.view + "_key ON " + pair.view + " (language, id)");
+        pair.viewReady.store(true, std::memory_order_release);
+    }
+    catch (const SqlException& e)
+    {
+        if(DeveloperMode::IsEnable) {
+            eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+        }
+    }
+    return pair.viewReady.load(std::memory_order_acquire);
+}
+
+void Projection::refreshView(Pair& pair)
+{
+    if(!pair.viewReady.load(std::memory_order_acquire)) {
+        //! Snapshots are read from the join until the view exists.
+        pair.generation.fetch_add(1, std::memory_order_acq_rel);
+        return;
+    }
+    //! Writes during a refresh are folded into one more refresh when it completes.
+    if(pair.refreshing.exchange(true, std::memory_order_acq_rel)) {
+        pair.pending.store(true, std::memory_order_release);
+        return;
+    }
+    auto* target = &pair;
+    const auto done = [target]() {
+        target->generation.fetch_add(1, std::memory_order_acq_rel);
+        Query::invalidate(target->view);
+        target->refreshing.store(false, std::memory_order_release);
+        if(target->pending.exchange(false, std::memory_order_acq_rel)) {
+            refreshView(*target);
+        }
+    };
+    Router::writer()->execSqlAsync("REFRESH MATERIALIZED VIEW CONCURRENTLY " + pair.view, [done](const SqlResult&) { done(); },
+                                   [target, done](const SqlException& e) {
+                                       //! The view is stale from now on, so the join is read until it is created again.
+                                       target->viewReady.store(false, std::memory_order_release);
+                                       eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+                                       done();
+                                   });
+}
+
+void Projection::touch(const std::string& table)
+{
+    //! Writes of a tenant go to its own database, so the projections of the default site stay valid.
+    if(TenantRouter::current().has_value()) {
+        return;
+    }
+    Pair* pair{nullptr};
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_tables.find(table);
+        if(it == m_tables.end()) {
+            return;
+        }
+        pair = it->second;
+    }
+    if(mode() == ProjectionMode::MaterializedView) {
+        refreshView(*pair);
+    } else {
+        pair->generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+void Projection::touchAll()
+{
+    if(TenantRouter::current().has_value()) {
+        return;
+    }
+    std::vector<Pair*> pairs{};
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        for(const auto& [name, pair] : m_pairs) pairs.push_back(pair.get());
+    }
+    const bool view = !pairs.empty() && mode() == ProjectionMode::MaterializedView;
+    for(auto* pair : pairs) {
+        if(view) refreshView(*pair);
+        else pair->generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+ProjectionSnapshotPtr Projection::build(Pair& pair, const std::string& language)
+{
+    const bool view = mode() == ProjectionMode::MaterializedView && ensureView(pair);
+    Statement statement{};
+    statement.id        = "projection." + pair.key;
+    statement.sql       = FROM_TEGRA_STRING(SELECT) + " * " + FROM + __tegra_space + (view ? pair.view : join(pair.key, pair.value))
+                          + __tegra_space + WHERE + " language = " + Query::placeholder(1);
+    statement.tables    = { pair.key, pair.value };
+    statement.cacheable = false;
+    //! A snapshot lives until the next write, so it is read from the primary; a lagging replica would pin stale rows.
+    statement.intent    = QueryIntent::Read;
+    const auto result = Query::select(statement, language);
+
+    auto res = std::make_shared<ProjectionSnapshot>();
+    const std::size_t columns = result.columns();
+    std::optional<std::size_t> key{};
+    res->m_columns.reserve(columns);
+    res->m_values.resize(columns);
+    for(std::size_t i = 0; i < columns; ++i) {
+        res->m_columns.push_back(result.columnName(i));
+        res->m_values[i].reserve(result.size());
+        if(res->m_columns.back() == "id") key = i;
+    }
+    std::size_t row{};
+    for(const auto& r : result) {
+        for(std::size_t i = 0; i < columns; ++i) {
+            res->m_values[i].push_back(r[i].isNull() ? __tegra_null_str : r[i].as<std::string>());
+        }
+        if(key.has_value()) res->m_rows.emplace(r[key.value()].as<u64>(), row);
+        ++row;
+    }
+    return res;
+}
+
+ProjectionSnapshotPtr Projection::snapshot(const std::string& table, const std::string& language)
+{
+    //! Snapshots belong to the default site; tenants read through the query cache.
+    if(TenantRouter::current().has_value() || mode() == ProjectionMode::Off) {
+        return nullptr;
+    }
+    auto pair = pairOf(table);
+    if(pair == nullptr) {
+        return nullptr;
+    }
+    const auto slot = table + '\x1f' + language;
+    //! The generation is taken before the read, so a write that lands in between leaves the new snapshot stale.
+    const auto generation = pair->generation.load(std::memory_order_acquire);
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_slots.find(slot);
+        if(it != m_slots.end() && it->second.generation == generation) {
+            return it->second.data;
+        }
+    }
+    try
+    {
+        auto data = build(*pair, language);
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        auto& current = m_slots[slot];
+        if(current.generation <= generation) {
+            current = { generation, data };
+        }
+        return data;
+    }
+    catch (const SqlException& e)
+    {
+        if(DeveloperMode::IsEnable) {
+            eLogger::Log("Database Error: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Critical);
+        }
+    }
+    //! A failed rebuild keeps serving the last snapshot.
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_slots.find(slot);
+    return it == m_slots.end() ? nullptr : it->second.data;
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,185 @@
+/*!
+ * @file        projection.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Denormalized per-language projections of key/value table pairs.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_PROJECTION_HPP
+#define TEGRA_DATABASE_PROJECTION_HPP
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include("core/database.hpp")
+#   include "core/database.hpp"
+#else
+#   error "Tegra's database was not found!"
+# endif
+#endif
+
+//! Tegra's Database Query.
+#ifdef __has_include
+# if __has_include("query.hpp")
+#   include "query.hpp"
+#else
+#   error "Tegra's database query was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+/*!
+ * @brief Storage of the projections.
+ */
+enum class ProjectionMode : u8
+{
+    Off                 = 0x0, ///<Every read joins the key and the value table.
+    Memory              = 0x1, ///<Per-language snapshot kept in the process, rebuilt after a write to the pair.
+    MaterializedView    = 0x2  ///<PostgreSQL materialized view refreshed concurrently after a write; snapshots are built from the view.
+};
+
+/*!
+ * @brief The ProjectionSnapshot class holds one language of a key/value pair, stored by column.
+ */
+class __tegra_export ProjectionSnapshot final
+{
+public:
+    /*!
+     * @brief size function returns the number of rows.
+     */
+    __tegra_no_discard std::size_t size() const __tegra_noexcept;
+
+    /*!
+     * @brief columns function returns the names of the columns.
+     */
+    __tegra_no_discard const VectorString& columns() const __tegra_noexcept;
+
+    /*!
+     * @brief column function returns the position of a column.
+     * @param name is the name of the column.
+     */
+    __tegra_no_discard std::optional<std::size_t> column(std::string_view name) const;
+
+    /*!
+     * @brief find function returns the row of an id.
+     * @param id is the key of the row.
+     */
+    __tegra_no_discard std::optional<std::size_t> find(u64 id) const;
+
+    /*!
+     * @brief value function returns a cell, NULL is returned as an empty string.
+     * @param row is the position of the row.
+     * @param column is the name of the column.
+     */
+    __tegra_no_discard std::string_view value(std::size_t row, std::string_view column) const;
+
+    /*!
+     * @brief values function returns a whole column.
+     * @param column is the name of the column.
+     */
+    __tegra_no_discard const VectorString& values(std::string_view column) const;
+
+private:
+    friend class Projection;
+    VectorString                            m_columns   {};
+    std::vector<VectorString>               m_values    {};     ///< One vector per column.
+    std::unordered_map<u64, std::size_t>    m_rows      {};     ///< Id to row.
+};
+
+using ProjectionSnapshotPtr = std::shared_ptr<const ProjectionSnapshot>;
+
+/*!
+ * @brief The Projection class maintains read-mostly key/value pairs (e.g. config and config_l) as one relation per language.
+ * Reads take the shared snapshot of their language; a write to either table of a pair marks its snapshots stale, and the next read of a language rebuilds only that language.
+ * @example auto config = Projection::snapshot("config", "english"); auto value = config->value(*config->find(1), "value");
+ */
+class __tegra_export Projection final
+{
+public:
+    /*!
+     * @brief configure function sets the mode and adds the projected pairs; pairs are never removed.
+     * @param mode is the storage, MaterializedView falls back to Memory on drivers other than PostgreSQL.
+     * @param tables are the key tables without prefix, e.g. config, menu.
+     * @param prefix is the table prefix.
+     * @param suffix is the suffix of the value tables.
+     */
+    static void configure(ProjectionMode mode, const VectorString& tables, const std::string& prefix, const std::string& suffix);
+
+    /*!
+     * @brief snapshot function returns the projection of a pair for a language.
+     * @param table is the key table without prefix.
+     * @param language is the language code.
+     * @returns the snapshot, or nullptr if the table is not projected, can not be read or a tenant is bound to the thread.
+     */
+    __tegra_no_discard static ProjectionSnapshotPtr snapshot(const std::string& table, const std::string& language);
+
+    /*!
+     * @brief relation function returns the SQL relation to read a projected pair from, usable after FROM.
+     * @param table is the key table without prefix.
+     * @returns the materialized view, or the join of the pair.
+     */
+    __tegra_no_discard static std::string relation(const std::string& table);
+
+    /*!
+     * @brief touch function marks the projection of a written table stale; called by Query::invalidate.
+     * @param table is the full table name.
+     */
+    static void touch(const std::string& table);
+
+    /*!
+     * @brief touchAll function marks every projection stale.
+     */
+    static void touchAll();
+
+    /*!
+     * @brief isProjected checks if a key table is projected.
+     * @param table is the key table without prefix.
+     */
+    __tegra_no_discard static bool isProjected(const std::string& table);
+
+    /*!
+     * @brief mode function returns the effective mode.
+     */
+    __tegra_no_discard static ProjectionMode mode() __tegra_noexcept;
+
+private:
+    struct Pair final
+    {
+        std::string         key         {};     ///< Full key table name.
+        std::string         value       {};     ///< Full value table name.
+        std::string         view        {};     ///< Materialized view name.
+        std::atomic<u64>    generation  {1};    ///< Bumped on every write to the pair.
+        std::atomic<bool>   viewReady   {false};
+        std::atomic<bool>   refreshing  {false};
+        std::atomic<bool>   pending     {false};
+    };
+
+    struct Slot final
+    {
+        u64                     generation  {};
+        ProjectionSnapshotPtr   data        {};
+    };
+
+    __tegra_no_discard static Pair* pairOf(const std::string& table);
+    __tegra_no_discard static std::string join(const std::string& key, const std::string& value);
+    static bool ensureView(Pair& pair);
+    static void refreshView(Pair& pair);
+    __tegra_no_discard static ProjectionSnapshotPtr build(Pair& pair, const std::string& language);
+
+    __tegra_inline_static std::shared_mutex                                     m_mutex     {};
+    __tegra_inline_static std::unordered_map<std::string, Scope<Pair>>          m_pairs     {};     ///< Key table without prefix to pair.
+    __tegra_inline_static std::unordered_map<std::string, Pair*>                m_tables    {};     ///< Full table name to pair.
+    __tegra_inline_static std::unordered_map<std::string, Slot>                 m_slots     {};     ///< Table and language to snapshot.
+    __tegra_inline_static std::atomic<ProjectionMode>                           m_mode      {ProjectionMode::Off};
+    __tegra_inline_static std::string                                           m_prefix    {};
+    __tegra_inline_static std::string                                           m_suffix    {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_PROJECTION_HPP
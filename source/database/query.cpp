@@ -0,0 +1,201 @@
+//! Tegra's Database Query.
+#ifdef __has_include
+# if __has_include("query.hpp")
+#   include "query.hpp"
+#else
+#   error "Tegra's database query was not found!"
+# endif
+#endif
+
+//! Tegra's Database Projection.
+#ifdef __has_include
+# if __has_include("projection.hpp")
+#   include "projection.hpp"
+#else
+#   error "Tegra's database projection was not found!"
+# endif
+#endif
+
+//! Tegra's Cache Tags.
+#ifdef __has_include
+# if __has_include("cache/tags.hpp")
+#   include "cache/tags.hpp"
+#else
+#   error "Tegra's cache tags was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+s64 nowSeconds() __tegra_noexcept
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+s64 steadyMilliseconds() __tegra_noexcept
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string lowerCase(std::string_view value)
+{
+    std::string res(value);
+    std::transform(res.begin(), res.end(), res.begin(), [](unsigned char c) { return std::tolower(c); });
+    return res;
+}
+
+TEGRA_NAMESPACE_END
+
+std::optional<SqlResult> Query::lookup(const std::string& key)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if(it == m_entries.end() || (it->second.expiresAt != __tegra_zero && it->second.expiresAt <= nowSeconds())) {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    return it->second.result;
+}
+
+u64 Query::tablesVersion(const VectorString& tables)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    //! The counters only grow, so their sum changes with any of them.
+    u64 version = m_epoch;
+    for(const auto& t : tables) {
+        auto it = m_versions.find(t);
+        if(it != m_versions.end()) version += it->second;
+    }
+    return version;
+}
+
+void Query::store(const std::string& key, const Statement& statement, u64 version, const SqlResult& result)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    u64 current = m_epoch;
+    for(const auto& t : statement.tables) {
+        auto it = m_versions.find(t);
+        if(it != m_versions.end()) current += it->second;
+    }
+    if(current != version) {
+        return;
+    }
+    if(m_entries.size() >= capacity.load(std::memory_order_relaxed)) {
+        //! Expired entries go first; a full cache of live entries starts over.
+        const auto now = nowSeconds();
+        std::erase_if(m_entries, [now](const auto& e) { return e.second.expiresAt != __tegra_zero && e.second.expiresAt <= now; });
+        if(m_entries.size() >= capacity.load(std::memory_order_relaxed)) {
+            m_entries.clear();
+            m_tags.clear();
+        }
+    }
+    Entry entry { result, statement.tables, statement.ttl == __tegra_zero ? __tegra_zero : nowSeconds() + statement.ttl };
+    m_entries.insert_or_assign(key, std::move(entry));
+    for(const auto& t : statement.tables) {
+        m_tags[t].insert(key);
+    }
+}
+
+void Query::invalidate(const std::string& table)
+{
+    if(table.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        ++m_versions[table];
+        m_written[table] = steadyMilliseconds();
+        auto tag = m_tags.find(table);
+        if(tag != m_tags.end()) {
+            for(const auto& key : tag->second) {
+                m_invalidations.fetch_add(m_entries.erase(key), std::memory_order_relaxed);
+            }
+            m_tags.erase(tag);
+        }
+    }
+    Projection::touch(table);
+    Cache::TagIndex::invalidateTag("table:" + table);
+}
+
+void Query::invalidateAll()
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    //! Tables that were never written have no version, so the epoch guards their reads in flight.
+    ++m_epoch;
+    m_writtenAll.store(steadyMilliseconds(), std::memory_order_relaxed);
+    m_invalidations.fetch_add(m_entries.size(), std::memory_order_relaxed);
+    m_entries.clear();
+    m_tags.clear();
+    lock.unlock();
+    Projection::touchAll();
+    Cache::TagIndex::invalidateAll();
+}
+
+QueryIntent Query::intentOf(const VectorString& tables, QueryIntent intent)
+{
+    if(intent != QueryIntent::ReplicaSafe) {
+        return intent;
+    }
+    const auto window = std::max<s64>(primaryWindow.load(std::memory_order_relaxed), Router::maxLag());
+    const auto since = steadyMilliseconds() - window;
+    if(m_writtenAll.load(std::memory_order_relaxed) > since) {
+        return QueryIntent::Read;
+    }
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for(const auto& t : tables) {
+        auto it = m_written.find(t);
+        if(it != m_written.end() && it->second > since) {
+            return QueryIntent::Read;
+        }
+    }
+    return intent;
+}
+
+std::string Query::placeholder(u32 index)
+{
+    auto clientPtr = Router::writer();
+    if(clientPtr != nullptr && clientPtr->type() != Orm::ClientType::PostgreSQL) {
+        return "?";
+    }
+    return "$" + TO_TEGRA_STRING(index);
+}
+
+QueryCacheStats Query::stats()
+{
+    QueryCacheStats res{};
+    res.hits            = m_hits.load(std::memory_order_relaxed);
+    res.misses          = m_misses.load(std::memory_order_relaxed);
+    res.invalidations   = m_invalidations.load(std::memory_order_relaxed);
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    res.entries         = m_entries.size();
+    return res;
+}
+
+std::string Query::writtenTable(const std::string& sql)
+{
+    std::istringstream stream(sql);
+    std::string word{}, previous{};
+    while(stream >> word) {
+        const auto lower = lowerCase(word);
+        //! The table follows INTO (insert/replace), UPDATE or FROM (delete).
+        if(previous == "into" || previous == "update" || (previous == "from" && lower != "only")) {
+            std::string name{};
+            for(const auto c : word) {
+                if(c == '(' || c == ';') break;
+                if(c != '"' && c != '`') name += c;
+            }
+            return name;
+        }
+        if(lower == "into" || lower == "update" || lower == "from") {
+            previous = lower;
+        }
+    }
+    return __tegra_null_str;
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,267 @@
+/*!
+ * @file        query.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Statement wrapper over the database clients with a tagged result cache.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_QUERY_HPP
+#define TEGRA_DATABASE_QUERY_HPP
+
+//! Tegra's Database Router.
+#ifdef __has_include
+# if __has_include("router.hpp")
+#   include "router.hpp"
+#else
+#   error "Tegra's database router was not found!"
+# endif
+#endif
+
+//! Tegra's Database Tenant.
+#ifdef __has_include
+# if __has_include("tenant.hpp")
+#   include "tenant.hpp"
+#else
+#   error "Tegra's database tenant was not found!"
+# endif
+#endif
+
+//! Tegra's Database Statistics.
+#ifdef __has_include
+# if __has_include("statistics.hpp")
+#   include "statistics.hpp"
+#else
+#   error "Tegra's database statistics was not found!"
+# endif
+#endif
+
+//! Tegra's Tracing.
+#ifdef __has_include
+# if __has_include("core/tracing.hpp")
+#   include "core/tracing.hpp"
+#else
+#   error "Tegra's tracing was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+/*!
+ * @brief The Statement struct describes a prepared statement of the application.
+ * @example Statement { .id = "seo.config", .sql = "SELECT ...", .tables = {"teg_config", "teg_config_l"} }
+ */
+struct Statement final
+{
+    std::string     id          {};                         ///< Stable identifier of the statement, used as the cache key.
+    std::string     sql         {};                         ///< Statement with driver placeholders.
+    VectorString    tables      {};                         ///< Tables that are read (select) or written (execute) by the statement.
+    QueryIntent     intent      {QueryIntent::ReplicaSafe}; ///< Routing intent of the statement.
+    u32             ttl         {};                         ///< Time to live in seconds for out-of-band writes, zero keeps the result until a tagged write.
+    bool            cacheable   {true};                     ///< Result of the statement can be cached.
+};
+
+/*!
+ * @brief The QueryCacheStats struct holds the counters of the result cache.
+ */
+struct QueryCacheStats final
+{
+    u64 hits            {}; ///< Number of results served from the cache.
+    u64 misses          {}; ///< Number of statements executed against the database.
+    u64 invalidations   {}; ///< Number of entries dropped by tagged writes.
+    u64 entries         {}; ///< Number of entries currently stored.
+};
+
+/*!
+ * @brief The Query class executes statements through the router and caches the results of read statements.
+ * Every cached result is tagged with the tables of its statement, and a write through execute drops every result tagged with a written table.
+ */
+class __tegra_export Query final
+{
+public:
+    /*!
+     * @brief select function runs a read statement or returns its cached result.
+     * @param statement is the statement.
+     * @param args are the bound parameters.
+     * @returns result of the statement.
+     */
+    template<typename... Args>
+    __tegra_no_discard static SqlResult select(const Statement& statement, Args&&... args)
+    {
+        if(!statement.cacheable || !enabled.load(std::memory_order_relaxed)) {
+            return run(Router::client(intentOf(statement.tables, statement.intent)), statement.sql, args...);
+        }
+        const auto key = makeKey(statement, args...);
+        if(auto cached = lookup(key)) {
+            return *cached;
+        }
+        //! Versions are taken before the read, so a write that lands in between prevents storing a stale result.
+        const auto version = tablesVersion(statement.tables);
+        auto result = run(Router::client(intentOf(statement.tables, statement.intent)), statement.sql, args...);
+        store(key, statement, version, result);
+        return result;
+    }
+
+    /*!
+     * @brief execute function runs a write statement on the primary and invalidates all results tagged with its tables.
+     * @param statement is the statement, the tables are detected from the statement when they are not given.
+     * @param args are the bound parameters.
+     * @returns result of the statement.
+     */
+    template<typename... Args>
+    static SqlResult execute(const Statement& statement, Args&&... args)
+    {
+        auto result = run(Router::writer(), statement.sql, args...);
+        if(statement.tables.empty()) {
+            invalidate(writtenTable(statement.sql));
+        } else {
+            for(const auto& t : statement.tables) invalidate(t);
+        }
+        return result;
+    }
+
+    /*!
+     * @brief invalidate function drops every result tagged with the table and marks its projection stale.
+     * @param table is the name of the table.
+     */
+    static void invalidate(const std::string& table);
+
+    /*!
+     * @brief invalidateAll function drops every cached result.
+     */
+    static void invalidateAll();
+
+    /*!
+     * @brief intentOf function returns the intent to route a read of the tables with.
+     * A replica-safe read of a table written within the last primaryWindow milliseconds goes to the primary,
+     * so a replica that has not replayed the write yet cannot put the old rows back into a cache.
+     * @param tables are the tables read by the statement.
+     * @param intent is the intent of the statement.
+     * @returns QueryIntent::Read inside the window, otherwise the intent itself.
+     */
+    __tegra_no_discard static QueryIntent intentOf(const VectorString& tables, QueryIntent intent);
+
+    /*!
+     * @brief placeholder function returns the bind placeholder of the primary driver.
+     * @param index is the one-based position of the parameter.
+     * @returns $n for PostgreSQL and ? for MySQL and SQLite.
+     */
+    __tegra_no_discard static std::string placeholder(u32 index);
+
+    /*!
+     * @brief stats function returns the counters of the cache.
+     */
+    __tegra_no_discard static QueryCacheStats stats();
+
+    /*!
+     * @brief writtenTable function finds the target table of an INSERT, UPDATE, DELETE or REPLACE statement.
+     * @param sql is the statement.
+     * @returns name of the table or empty string.
+     */
+    __tegra_no_discard static std::string writtenTable(const std::string& sql);
+
+    /*!
+     * @brief Result cache can be switched off at runtime.
+     */
+    __tegra_inline_static std::atomic<bool> enabled { true };
+
+    /*!
+     * @brief Maximum number of cached results.
+     */
+    __tegra_inline_static std::atomic<u32> capacity { 4096 };
+
+    /*!
+     * @brief Milliseconds after a write during which the written tables are read from the primary; the largest max_lag of the replicas is used when it is longer.
+     */
+    __tegra_inline_static std::atomic<u32> primaryWindow { 5000 };
+
+private:
+    struct Entry final
+    {
+        SqlResult       result;
+        VectorString    tables      {};
+        s64             expiresAt   {};
+    };
+
+    template<typename... Args>
+    __tegra_no_discard static SqlResult run(const Orm::DbClientPtr& client, const std::string& sql, const Args&... args)
+    {
+        System::Span span("db.query", System::SpanKind::Client);
+        if(span.isRecording()) {
+            span.setAttribute("db.statement", QueryStatistics::normalize(sql));
+        }
+        const auto start = std::chrono::steady_clock::now();
+        const auto elapsed = [&start]() {
+            return static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        };
+        try
+        {
+            auto result = client->execSqlSync(sql, args...);
+            const auto micros = elapsed();
+            QueryStatistics::record(sql, micros, result.empty() ? result.affectedRows() : result.size(), false,
+                                    QueryStatistics::isSlow(micros) ? QueryStatistics::parameterShape(args...) : __tegra_null_str);
+            return result;
+        }
+        catch (const SqlException& e)
+        {
+            QueryStatistics::record(sql, elapsed(), __tegra_zero, true, QueryStatistics::parameterShape(args...));
+            span.setError(e.base().what());
+            throw;
+        }
+    }
+
+    template<typename T>
+    static void appendParam(std::string& key, const T& value)
+    {
+        using Type = std::decay_t<T>;
+        std::string part{};
+        if constexpr (std::is_same_v<Type, bool>) {
+            part = value ? "1" : "0";
+        } else if constexpr (std::is_arithmetic_v<Type>) {
+            part = TO_TEGRA_STRING(value);
+        } else if constexpr (std::is_convertible_v<const Type&, std::string_view>) {
+            part = FROM_TEGRA_STRING(std::string_view(value));
+        } else {
+            static_assert(std::is_arithmetic_v<Type>, "Unsupported parameter type for a cached statement.");
+        }
+        //! Length prefix keeps ("a,b") and ("a", "b") apart.
+        key += TO_TEGRA_STRING(part.size());
+        key += ':';
+        key += part;
+    }
+
+    template<typename... Args>
+    __tegra_no_discard static std::string makeKey(const Statement& statement, const Args&... args)
+    {
+        //! Tenants run the same statements against their own databases.
+        std::string key = TenantRouter::current().value_or(__tegra_null_str);
+        key += '\x1f';
+        key += statement.id.empty() ? statement.sql : statement.id;
+        key += '\x1f';
+        (appendParam(key, args), ...);
+        return key;
+    }
+
+    __tegra_no_discard static std::optional<SqlResult> lookup(const std::string& key);
+    __tegra_no_discard static u64 tablesVersion(const VectorString& tables);
+    static void store(const std::string& key, const Statement& statement, u64 version, const SqlResult& result);
+
+    __tegra_inline_static std::shared_mutex                                             m_mutex     {};
+    __tegra_inline_static std::unordered_map<std::string, Entry>                        m_entries   {};
+    __tegra_inline_static std::unordered_map<std::string, std::unordered_set<std::string>> m_tags   {};
+    __tegra_inline_static std::unordered_map<std::string, u64>                          m_versions  {};
+    __tegra_inline_static u64                                                           m_epoch     {};     ///< Increased by invalidateAll; part of every version.
+    __tegra_inline_static std::unordered_map<std::string, s64>                          m_written   {};
+    __tegra_inline_static std::atomic<s64>                                              m_writtenAll {};
+    __tegra_inline_static std::atomic<u64>                                              m_hits      {};
+    __tegra_inline_static std::atomic<u64>                                              m_misses    {};
+    __tegra_inline_static std::atomic<u64>                                              m_invalidations {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_QUERY_HPP
@@ -0,0 +1,123 @@
+//! Tegra's Database Registry.
+#ifdef __has_include
+# if __has_include("registry.hpp")
+#   include "registry.hpp"
+#else
+#   error "Tegra's database registry was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+const TableRegistry::Snapshot& TableRegistry::current()
+{
+    const auto revision = Configuration::revision.load(std::memory_order_acquire);
+    const auto* snapshot = m_current.load(std::memory_order_acquire);
+    if(snapshot != nullptr && m_revision.load(std::memory_order_acquire) == revision) {
+        return *snapshot;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    snapshot = m_current.load(std::memory_order_acquire);
+    if(snapshot == nullptr || m_revision.load(std::memory_order_acquire) != revision) {
+        std::string prefix  = snapshot == nullptr ? FROM_TEGRA_STRING(CONFIG::SYSTEM_TABLES_PREFIX) : snapshot->prefix;
+        std::string suffix  = snapshot == nullptr ? FROM_TEGRA_STRING(CONFIG::SYSTEM_TABLES_VALUE_STRUCT) : snapshot->suffix;
+        //! Only the sections that carry the table settings describe the tables; the others leave the snapshot as it is.
+        if(Configuration::GET.isMember("table_prefix"))       prefix = Configuration::GET["table_prefix"].asString();
+        if(Configuration::GET.isMember("table_value_struct")) suffix = Configuration::GET["table_value_struct"].asString();
+        if(snapshot == nullptr || prefix != snapshot->prefix || suffix != snapshot->suffix) {
+            rebuild(prefix, suffix, snapshot == nullptr ? DriverTypes::PostgreSQL : snapshot->driver);
+        }
+        m_revision.store(revision, std::memory_order_release);
+    }
+    return *m_current.load(std::memory_order_acquire);
+}
+
+void TableRegistry::rebuild(const std::string& prefix, const std::string& suffix, DriverTypes driver)
+{
+    auto snapshot       = CreateScope<Snapshot>();
+    snapshot->prefix    = prefix;
+    snapshot->suffix    = suffix;
+    snapshot->driver    = driver;
+    snapshot->entries.reserve(TEGRA_TABLES::ALL.size() + Constants::defaultTables.size() + m_modules.size());
+    const auto add = [&snapshot](std::string_view table) {
+        if(snapshot->index.contains(table)) return;
+        TableEntry entry{};
+        entry.table     = table;
+        entry.name      = snapshot->prefix + FROM_TEGRA_STRING(table);
+        entry.quoted    = snapshot->driver == DriverTypes::MySQL ? "`" + entry.name + "`" : "\"" + entry.name + "\"";
+        entry.role      = !snapshot->suffix.empty() && table.ends_with(snapshot->suffix) ? TableType::ValueSturct : TableType::KeyStruct;
+        snapshot->index.emplace(table, snapshot->entries.size());
+        snapshot->entries.push_back(std::move(entry));
+    };
+    //! Keys of the index point at the constants and at m_modules, not into the entries.
+    for(const auto& t : TEGRA_TABLES::ALL) add(t);
+    for(const auto& t : Constants::defaultTables) add(t);
+    for(const auto& t : m_modules) add(t);
+    m_current.store(snapshot.get(), std::memory_order_release);
+    m_snapshots.push_back(std::move(snapshot));
+}
+
+const TableEntry* TableRegistry::find(std::string_view table)
+{
+    const auto& snapshot = current();
+    auto it = snapshot.index.find(table);
+    return it == snapshot.index.end() ? nullptr : &snapshot.entries[it->second];
+}
+
+std::string_view TableRegistry::name(std::string_view table)
+{
+    const auto* entry = find(table);
+    return entry == nullptr ? std::string_view{} : std::string_view(entry->name);
+}
+
+std::string_view TableRegistry::quoted(std::string_view table)
+{
+    const auto* entry = find(table);
+    return entry == nullptr ? std::string_view{} : std::string_view(entry->quoted);
+}
+
+TableType TableRegistry::role(std::string_view table)
+{
+    if(const auto* entry = find(table)) {
+        return entry->role;
+    }
+    const auto value = suffix();
+    return !value.empty() && table.ends_with(value) ? TableType::ValueSturct : TableType::KeyStruct;
+}
+
+std::string_view TableRegistry::prefix()
+{
+    return current().prefix;
+}
+
+std::string_view TableRegistry::suffix()
+{
+    return current().suffix;
+}
+
+void TableRegistry::registerTable(std::string_view table)
+{
+    (void)current();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(std::find(m_modules.begin(), m_modules.end(), table) != m_modules.end()) {
+        return;
+    }
+    m_modules.emplace_back(table);
+    const auto* snapshot = m_current.load(std::memory_order_acquire);
+    rebuild(snapshot->prefix, snapshot->suffix, snapshot->driver);
+}
+
+void TableRegistry::setDriver(DriverTypes type)
+{
+    (void)current();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto* snapshot = m_current.load(std::memory_order_acquire);
+    if(snapshot->driver != type) {
+        rebuild(snapshot->prefix, snapshot->suffix, type);
+    }
+}
+
+TEGRA_NAMESPACE_END
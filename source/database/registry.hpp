@@ -0,0 +1,118 @@
+/*!
+ * @file        registry.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Precomputed registry of prefixed and quoted table names.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_REGISTRY_HPP
+#define TEGRA_DATABASE_REGISTRY_HPP
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include("core/database.hpp")
+#   include "core/database.hpp"
+#else
+#   error "Tegra's database was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+/*!
+ * @brief The TableEntry struct is one table of the registry.
+ */
+struct TableEntry final
+{
+    std::string_view    table   {};                     ///< Name without prefix, e.g. config_l.
+    std::string         name    {};                     ///< Prefixed name, e.g. teg_config_l.
+    std::string         quoted  {};                     ///< Prefixed name quoted for the driver, e.g. "teg_config_l" or `teg_config_l`.
+    TableType           role    {TableType::KeyStruct}; ///< Key or value table.
+};
+
+/*!
+ * @brief The TableRegistry class maps every system and module table to its prefixed name, once per configuration snapshot.
+ * Lookups return views into an immutable snapshot, so building a statement never allocates for an identifier.
+ * A snapshot is rebuilt only when the prefix, the value suffix, the driver or the module tables change; replaced snapshots are kept, so a view stays valid for the life of the process.
+ * @example auto sql = FROM_TEGRA_STRING("SELECT * FROM ") + TableRegistry::name(TEGRA_TABLES::CONFIG);
+ */
+class __tegra_export TableRegistry final
+{
+public:
+    /*!
+     * @brief find function returns the entry of a table.
+     * @param table is the name without prefix.
+     * @returns entry or nullptr for an unknown table.
+     */
+    __tegra_no_discard static const TableEntry* find(std::string_view table);
+
+    /*!
+     * @brief name function returns the prefixed name of a table.
+     * @param table is the name without prefix.
+     * @returns prefixed name, or an empty view for an unknown table.
+     */
+    __tegra_no_discard static std::string_view name(std::string_view table);
+
+    /*!
+     * @brief quoted function returns the prefixed name of a table quoted for the driver.
+     * @param table is the name without prefix.
+     * @returns quoted name, or an empty view for an unknown table.
+     */
+    __tegra_no_discard static std::string_view quoted(std::string_view table);
+
+    /*!
+     * @brief role function returns whether a name is a key or a value table, known or not.
+     * @param table is the name without prefix.
+     */
+    __tegra_no_discard static TableType role(std::string_view table);
+
+    /*!
+     * @brief prefix function returns the table prefix of the current snapshot.
+     */
+    __tegra_no_discard static std::string_view prefix();
+
+    /*!
+     * @brief suffix function returns the suffix of value tables of the current snapshot.
+     */
+    __tegra_no_discard static std::string_view suffix();
+
+    /*!
+     * @brief registerTable function adds a module table.
+     * @param table is the name without prefix.
+     */
+    static void registerTable(std::string_view table);
+
+    /*!
+     * @brief setDriver function sets the driver that decides the quoting.
+     * @param type is the driver of the primary.
+     */
+    static void setDriver(DriverTypes type);
+
+private:
+    struct Snapshot final
+    {
+        std::string                                     prefix  {};
+        std::string                                     suffix  {};
+        DriverTypes                                     driver  {DriverTypes::PostgreSQL};
+        std::vector<TableEntry>                         entries {};
+        std::unordered_map<std::string_view, std::size_t> index {};
+    };
+
+    __tegra_no_discard static const Snapshot& current();
+    static void rebuild(const std::string& prefix, const std::string& suffix, DriverTypes driver);
+
+    __tegra_inline_static std::mutex                        m_mutex     {};
+    __tegra_inline_static std::atomic<const Snapshot*>      m_current   {nullptr};
+    __tegra_inline_static std::atomic<u64>                  m_revision  {};
+    __tegra_inline_static std::vector<Scope<Snapshot>>      m_snapshots {};     ///< Every snapshot ever built, views into them must stay valid.
+    __tegra_inline_static std::deque<std::string>           m_modules   {};     ///< Module table names, never moved.
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_REGISTRY_HPP
@@ -0,0 +1,221 @@
+//! Tegra's Database Router.
+#ifdef __has_include
+# if __has_include("router.hpp")
+#   include "router.hpp"
+#else
+#   error "Tegra's database router was not found!"
+# endif
+#endif
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include(<database>)
+#   include <database>
+#else
+#   error "Tegra's database was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+s64 steadyMilliseconds() __tegra_noexcept
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//! Lag of a PostgreSQL standby, zero when everything received has been replayed.
+constexpr std::string_view POSTGRESQL_LAG_QUERY =
+    "SELECT (CASE WHEN pg_last_wal_receive_lsn() = pg_last_wal_replay_lsn() THEN 0 "
+    "ELSE COALESCE(EXTRACT(EPOCH FROM now() - pg_last_xact_replay_timestamp()) * 1000, -1) END)::BIGINT AS lag";
+
+constexpr std::string_view MYSQL_LAG_QUERY = "SHOW SLAVE STATUS";
+
+TEGRA_NAMESPACE_END
+
+void Router::registerNode(const ClientNode& node)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if(node.role == ClientRole::Primary) {
+        m_primary = node.name;
+        return;
+    }
+    for(const auto& r : m_replicas) {
+        if(r->node.name == node.name) {
+            r->node = node;
+            return;
+        }
+    }
+    auto state = CreateScope<NodeState>();
+    state->node = node;
+    if(state->node.weight == __tegra_zero) state->node.weight = 1;
+    //! A SQLite reader opens the same file as the writer, so it can not lag and is never probed.
+    if(state->node.rdbms == TEGRA_RDBMS::SQLite) state->lag.store(0, std::memory_order_relaxed);
+    m_replicas.push_back(std::move(state));
+}
+
+void Router::clear() __tegra_noexcept
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_primary = "default";
+    m_replicas.clear();
+}
+
+bool Router::isHealthy(const NodeState& state) __tegra_noexcept
+{
+    const auto lag = state.lag.load(std::memory_order_relaxed);
+    if(lag < __tegra_zero) return false;
+    return state.node.maxLag == __tegra_zero || static_cast<u64>(lag) <= state.node.maxLag;
+}
+
+std::string Router::clientName(QueryIntent intent)
+{
+    if(intent != QueryIntent::ReplicaSafe) {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_primary;
+    }
+
+    //! Probing is triggered by the read path itself, at most once per interval.
+    const auto now = steadyMilliseconds();
+    auto last = m_lastProbe.load(std::memory_order_relaxed);
+    if(now - last >= healthInterval.load(std::memory_order_relaxed)
+        && m_lastProbe.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        refreshHealth();
+    }
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    u64 total{};
+    for(const auto& r : m_replicas) {
+        if(isHealthy(*r)) total += r->node.weight;
+    }
+    if(total == __tegra_zero) {
+        return m_primary;
+    }
+    auto slot = m_cursor.fetch_add(1, std::memory_order_relaxed) % total;
+    for(const auto& r : m_replicas) {
+        if(!isHealthy(*r)) continue;
+        if(slot < r->node.weight) return r->node.name;
+        slot -= r->node.weight;
+    }
+    return m_primary;
+}
+
+Orm::DbClientPtr Router::client(QueryIntent intent)
+{
+    //! A tenant has one pool that serves every intent.
+    if(const auto& tenant = TenantRouter::current(); tenant.has_value()) {
+        if(auto clientPtr = TenantRouter::client(tenant.value())) {
+            return clientPtr;
+        }
+    }
+    auto clientPtr = AppFramework::application().getDbClient(clientName(intent));
+    if(isNullPtr(clientPtr) && intent == QueryIntent::ReplicaSafe) {
+        return writer();
+    }
+    return clientPtr;
+}
+
+Orm::DbClientPtr Router::writer()
+{
+    return client(QueryIntent::Write);
+}
+
+Orm::DbClientPtr Router::reader()
+{
+    return client(QueryIntent::ReplicaSafe);
+}
+
+void Router::updateLag(const std::string& name, s64 lag) __tegra_noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for(const auto& r : m_replicas) {
+        if(r->node.name == name) {
+            r->lag.store(lag, std::memory_order_relaxed);
+            if(lag < __tegra_zero || (r->node.maxLag != __tegra_zero && static_cast<u64>(lag) > r->node.maxLag)) {
+                if(DeveloperMode::IsEnable)
+                    eLogger::Log("Replica [" + name + "] is lagging, reads are routed elsewhere.", eLogger::LoggerType::Warning);
+            }
+            return;
+        }
+    }
+}
+
+void Router::refreshHealth()
+{
+    std::vector<ClientNode> nodes{};
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        for(const auto& r : m_replicas) nodes.push_back(r->node);
+    }
+    for(const auto& node : nodes) {
+        auto clientPtr = AppFramework::application().getDbClient(node.name);
+        if(isNullPtr(clientPtr)) {
+            updateLag(node.name, -1);
+            continue;
+        }
+        const auto name = node.name;
+        if(node.rdbms == TEGRA_RDBMS::SQLite) {
+            updateLag(name, 0);
+        } else if(node.rdbms == TEGRA_RDBMS::MySQL) {
+            clientPtr->execSqlAsync(FROM_TEGRA_STRING(MYSQL_LAG_QUERY),
+                [name](const SqlResult& result) {
+                    s64 lag{-1};
+                    for(const auto& row : result) {
+                        if(!row["Seconds_Behind_Master"].isNull())
+                            lag = row["Seconds_Behind_Master"].as<s64>() * 1000;
+                    }
+                    updateLag(name, lag);
+                },
+                [name](const SqlException& e) {
+                    if(DeveloperMode::IsEnable)
+                        eLogger::Log("Replica [" + name + "] probe failed: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Warning);
+                    updateLag(name, -1);
+                });
+        } else if(node.rdbms == TEGRA_RDBMS::PostgreSQL) {
+            clientPtr->execSqlAsync(FROM_TEGRA_STRING(POSTGRESQL_LAG_QUERY),
+                [name](const SqlResult& result) {
+                    s64 lag{-1};
+                    for(const auto& row : result) {
+                        lag = row["lag"].as<s64>();
+                    }
+                    updateLag(name, lag);
+                },
+                [name](const SqlException& e) {
+                    if(DeveloperMode::IsEnable)
+                        eLogger::Log("Replica [" + name + "] probe failed: " + FROM_TEGRA_STRING(e.base().what()), eLogger::LoggerType::Warning);
+                    updateLag(name, -1);
+                });
+        }
+    }
+}
+
+VectorString Router::replicas()
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    VectorString res{};
+    for(const auto& r : m_replicas) res.push_back(r->node.name);
+    return res;
+}
+
+u32 Router::maxLag() __tegra_noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    u32 res{};
+    for(const auto& r : m_replicas) res = std::max(res, r->node.maxLag);
+    return res;
+}
+
+bool Router::hasReplica() __tegra_noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for(const auto& r : m_replicas) {
+        if(isHealthy(*r)) return true;
+    }
+    return false;
+}
+
+TEGRA_NAMESPACE_END
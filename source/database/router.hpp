@@ -0,0 +1,153 @@
+/*!
+ * @file        router.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Read/write routing between primary and replica database clients.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_ROUTER_HPP
+#define TEGRA_DATABASE_ROUTER_HPP
+
+//! Tegra's Common.
+#ifdef __has_include
+# if __has_include(<common>)
+#   include <common>
+#else
+#   error "Tegra's common was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+/*!
+ * @brief Role of a database client inside the "database" section of the configuration.
+ * @example {"rdbms":"postgresql", "role":"replica", "client":"replica_1", "max_lag": 500, "host": "10.0.0.2", ...}
+ */
+enum class ClientRole : u8
+{
+    Primary     = 0x0, ///<Accepts reads and writes (named "default" for the framework).
+    Replica     = 0x1  ///<Read-only streaming replica.
+};
+
+/*!
+ * @brief Intent of a statement; the router picks the client based on it.
+ */
+enum class QueryIntent : u8
+{
+    Write       = 0x0, ///<Always goes to the primary.
+    Read        = 0x1, ///<Read that must see its own writes (primary).
+    ReplicaSafe = 0x2  ///<Read that tolerates replication lag (SEO meta, menus, translations, listings).
+};
+
+/*!
+ * @brief The ClientNode struct describes one named client created by the connection.
+ */
+struct ClientNode final
+{
+    std::string     name        {};     ///< Name of the client inside the framework.
+    std::string     rdbms       {};     ///< Driver of the client, e.g. postgresql.
+    ClientRole      role        {};     ///< Primary or replica.
+    u32             maxLag      {};     ///< Maximum accepted replication lag in milliseconds (replicas only).
+    u32             weight      {1};    ///< Relative share of replica-safe reads.
+};
+
+/*!
+ * @brief The Router class keeps the registry of named clients and routes every statement to the primary or a healthy replica.
+ * Replicas are balanced with a weighted round-robin and are skipped while their last reported lag exceeds their max_lag or they are marked down.
+ * A replica starts down and takes reads only once a probe has measured its lag; a SQLite reader shares the file of the writer and starts up.
+ * Health is refreshed asynchronously from the read path, so routing itself never blocks on a probe.
+ */
+class __tegra_export Router final
+{
+public:
+    /*!
+     * @brief registerNode function will register a created client inside the router.
+     * @param node is the client description.
+     */
+    static void registerNode(const ClientNode& node);
+
+    /*!
+     * @brief clear function will remove all registered clients.
+     */
+    static void clear() __tegra_noexcept;
+
+    /*!
+     * @brief client function will pick a client based on the intent of the statement.
+     * @param intent as type of statement.
+     * @returns database client (primary if no healthy replica is available).
+     */
+    __tegra_no_discard static Orm::DbClientPtr client(QueryIntent intent);
+
+    /*!
+     * @brief writer function returns the primary client.
+     */
+    __tegra_no_discard static Orm::DbClientPtr writer();
+
+    /*!
+     * @brief reader function returns a healthy replica for replica-safe reads.
+     */
+    __tegra_no_discard static Orm::DbClientPtr reader();
+
+    /*!
+     * @brief clientName function will pick a client name based on the intent of the statement.
+     * @param intent as type of statement.
+     * @returns name of the client.
+     */
+    __tegra_no_discard static std::string clientName(QueryIntent intent);
+
+    /*!
+     * @brief updateLag function will store the last measured replication lag of a replica.
+     * @param name of the replica.
+     * @param lag in milliseconds, negative value marks the replica as down.
+     */
+    static void updateLag(const std::string& name, s64 lag) __tegra_noexcept;
+
+    /*!
+     * @brief refreshHealth function will probe every replica asynchronously for its lag.
+     */
+    static void refreshHealth();
+
+    /*!
+     * @brief replicas function returns the name of all registered replicas.
+     */
+    __tegra_no_discard static VectorString replicas();
+
+    /*!
+     * @brief maxLag function returns the largest max_lag of the registered replicas in milliseconds.
+     */
+    __tegra_no_discard static u32 maxLag() __tegra_noexcept;
+
+    /*!
+     * @brief hasReplica checks if at least one replica is healthy.
+     */
+    __tegra_no_discard static bool hasReplica() __tegra_noexcept;
+
+    /*!
+     * @brief Interval of health probes in milliseconds.
+     */
+    __tegra_inline_static std::atomic<u32> healthInterval { 1000 };
+
+private:
+    struct NodeState final
+    {
+        ClientNode              node    {};
+        std::atomic<s64>        lag     {-1};   ///< Down until the first probe answers.
+    };
+
+    __tegra_no_discard static bool isHealthy(const NodeState& state) __tegra_noexcept;
+
+    __tegra_inline_static std::shared_mutex             m_mutex         {};
+    __tegra_inline_static std::string                   m_primary       {"default"};
+    __tegra_inline_static std::vector<Scope<NodeState>> m_replicas      {};
+    __tegra_inline_static std::atomic<u64>              m_cursor        {};
+    __tegra_inline_static std::atomic<s64>              m_lastProbe     {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_ROUTER_HPP
@@ -0,0 +1,267 @@
+//! Tegra's Database Statistics.
+#ifdef __has_include
+# if __has_include("statistics.hpp")
+#   include "statistics.hpp"
+#else
+#   error "Tegra's database statistics was not found!"
+# endif
+#endif
+
+//! Tegra's Logger.
+#ifdef __has_include
+# if __has_include(<logger>)
+#   include <logger>
+#else
+#   error "Tegra's logger was not found!"
+# endif
+#endif
+
+//! Tegra's Timing.
+#ifdef __has_include
+# if __has_include("core/timing.hpp")
+#   include "core/timing.hpp"
+#else
+#   error "Tegra's timing was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+//! Raw statements that build literals into the text would grow the raw lookup forever.
+constexpr std::size_t MAX_RAW_STATEMENTS = 4096;
+
+bool isIdentifier(char c) __tegra_noexcept
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool sampled(double rate)
+{
+    if(rate >= 1.0) return true;
+    if(rate <= 0.0) return false;
+    thread_local std::minstd_rand engine { std::random_device{}() };
+    return std::uniform_real_distribution<double>(0.0, 1.0)(engine) < rate;
+}
+
+TEGRA_NAMESPACE_END
+
+u32 LatencyHistogram::indexOf(u64 micros) __tegra_noexcept
+{
+    if(micros < SubBuckets) {
+        return static_cast<u32>(micros);
+    }
+    const u32 exponent = static_cast<u32>(std::bit_width(micros)) - 1;
+    const u32 sub = static_cast<u32>((micros >> (exponent - 4)) & (SubBuckets - 1));
+    return std::min<u32>((exponent - 3) * SubBuckets + sub, Buckets - 1);
+}
+
+u64 LatencyHistogram::upperBound(u32 index) __tegra_noexcept
+{
+    if(index < SubBuckets) {
+        return index;
+    }
+    const u32 exponent = index / SubBuckets + 3;
+    const u64 sub = index % SubBuckets;
+    return ((SubBuckets + sub + 1) << (exponent - 4)) - 1;
+}
+
+void LatencyHistogram::record(u64 micros) __tegra_noexcept
+{
+    m_buckets[indexOf(micros)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    auto current = m_max.load(std::memory_order_relaxed);
+    while(micros > current && !m_max.compare_exchange_weak(current, micros, std::memory_order_relaxed)) {}
+}
+
+u64 LatencyHistogram::percentile(double q) const __tegra_noexcept
+{
+    const auto total = m_count.load(std::memory_order_relaxed);
+    if(total == __tegra_zero) {
+        return __tegra_zero;
+    }
+    const auto rank = std::max<u64>(1, static_cast<u64>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(total))));
+    u64 seen{};
+    for(u32 i = 0; i < Buckets; ++i) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if(seen >= rank) {
+            return std::min(upperBound(i), max());
+        }
+    }
+    return max();
+}
+
+u64 LatencyHistogram::count() const __tegra_noexcept
+{
+    return m_count.load(std::memory_order_relaxed);
+}
+
+u64 LatencyHistogram::max() const __tegra_noexcept
+{
+    return m_max.load(std::memory_order_relaxed);
+}
+
+u64 LatencyHistogram::bucket(u32 index) const __tegra_noexcept
+{
+    return index < Buckets ? m_buckets[index].load(std::memory_order_relaxed) : __tegra_zero;
+}
+
+std::string QueryStatistics::normalize(std::string_view sql)
+{
+    std::string res{};
+    res.reserve(sql.size());
+    for(std::size_t i = 0; i < sql.size(); ++i) {
+        const char c = sql[i];
+        if(c == '\'') {
+            //! String literal, '' is an escaped quote.
+            for(++i; i < sql.size(); ++i) {
+                if(sql[i] == '\'' && (i + 1 >= sql.size() || sql[i + 1] != '\'')) break;
+                if(sql[i] == '\'') ++i;
+            }
+            res += '?';
+        } else if(c == '$' && i + 1 < sql.size() && std::isdigit(static_cast<unsigned char>(sql[i + 1]))) {
+            while(i + 1 < sql.size() && std::isdigit(static_cast<unsigned char>(sql[i + 1]))) ++i;
+            res += '?';
+        } else if(std::isdigit(static_cast<unsigned char>(c)) && (res.empty() || !isIdentifier(res.back()))) {
+            while(i + 1 < sql.size() && (std::isalnum(static_cast<unsigned char>(sql[i + 1])) || sql[i + 1] == '.')) ++i;
+            res += '?';
+        } else if(std::isspace(static_cast<unsigned char>(c))) {
+            if(!res.empty() && res.back() != ' ') res += ' ';
+        } else {
+            res += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+    }
+    while(!res.empty() && (res.back() == ' ' || res.back() == ';')) res.pop_back();
+
+    //! Value lists of any length share one fingerprint: (?, ?, ?) becomes (?+).
+    std::string collapsed{};
+    collapsed.reserve(res.size());
+    for(std::size_t i = 0; i < res.size(); ++i) {
+        if(res.compare(i, 2, "(?") == 0) {
+            std::size_t j = i + 2;
+            u32 items{1};
+            while(res.compare(j, 3, ", ?") == 0 || res.compare(j, 2, ",?") == 0) {
+                j += res[j + 1] == ' ' ? 3 : 2;
+                ++items;
+            }
+            if(items > 1 && j < res.size() && res[j] == ')') {
+                collapsed += "(?+)";
+                i = j;
+                continue;
+            }
+        }
+        collapsed += res[i];
+    }
+    //! Multi-row VALUES lists as well.
+    for(auto at = collapsed.find("(?+), (?+)"); at != std::string::npos; at = collapsed.find("(?+), (?+)", at)) {
+        collapsed.erase(at + 4, 6);
+    }
+    return collapsed;
+}
+
+StatementStats& QueryStatistics::statsOf(const std::string& sql)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_raw.find(sql);
+        if(it != m_raw.end()) return *it->second;
+    }
+    auto fingerprint = normalize(sql);
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    auto& stats = m_statements[fingerprint];
+    if(!stats) {
+        stats = CreateScope<StatementStats>();
+        stats->fingerprint = fingerprint;
+    }
+    if(m_raw.size() < MAX_RAW_STATEMENTS) {
+        m_raw.emplace(sql, stats.get());
+    }
+    return *stats;
+}
+
+bool QueryStatistics::isSlow(u64 micros) __tegra_noexcept
+{
+    return micros >= static_cast<u64>(slowThreshold.load(std::memory_order_relaxed)) * 1000;
+}
+
+void QueryStatistics::record(const std::string& sql, u64 micros, u64 rows, bool failed, const std::string& parameters)
+{
+    if(auto* timer = System::RequestTimer::current()) {
+        timer->add(System::Phase::Sql, micros);
+    }
+    if(!enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    auto& stats = statsOf(sql);
+    stats.calls.fetch_add(1, std::memory_order_relaxed);
+    stats.rows.fetch_add(rows, std::memory_order_relaxed);
+    stats.totalMicros.fetch_add(micros, std::memory_order_relaxed);
+    stats.latency.record(micros);
+    if(failed) {
+        stats.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    if(isSlow(micros) && sampled(sampleRate.load(std::memory_order_relaxed))) {
+        {
+            std::lock_guard<std::mutex> lock(m_slowMutex);
+            m_slow.push_back({ stats.fingerprint, parameters, micros, rows, std::time(nullptr) });
+            while(m_slow.size() > slowLogSize.load(std::memory_order_relaxed)) m_slow.pop_front();
+        }
+        eLogger::Log(eLogger::LoggerType::Warning, "Slow query ({} ms, {} rows): {}{}{}{}", micros / 1000, rows, stats.fingerprint,
+                     parameters.empty() ? "" : " [", parameters, parameters.empty() ? "" : "]");
+    }
+}
+
+std::vector<SlowQuery> QueryStatistics::slowQueries()
+{
+    std::lock_guard<std::mutex> lock(m_slowMutex);
+    return { m_slow.begin(), m_slow.end() };
+}
+
+void QueryStatistics::forEach(const std::function<void(const std::string& fingerprint, const StatementStats& stats)>& visitor)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for(const auto& [fingerprint, stats] : m_statements) {
+        visitor(fingerprint, *stats);
+    }
+}
+
+JSonData QueryStatistics::snapshot()
+{
+    JSonData res{};
+    JSonData statements(Json::arrayValue);
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        for(const auto& [fingerprint, stats] : m_statements) {
+            JSonData item{};
+            const auto calls = stats->calls.load(std::memory_order_relaxed);
+            item["fingerprint"] = fingerprint;
+            item["calls"]       = Json::UInt64(calls);
+            item["errors"]      = Json::UInt64(stats->errors.load(std::memory_order_relaxed));
+            item["rows"]        = Json::UInt64(stats->rows.load(std::memory_order_relaxed));
+            item["mean_us"]     = Json::UInt64(calls == __tegra_zero ? 0 : stats->totalMicros.load(std::memory_order_relaxed) / calls);
+            item["p50_us"]      = Json::UInt64(stats->latency.percentile(0.50));
+            item["p95_us"]      = Json::UInt64(stats->latency.percentile(0.95));
+            item["p99_us"]      = Json::UInt64(stats->latency.percentile(0.99));
+            item["max_us"]      = Json::UInt64(stats->latency.max());
+            statements.append(item);
+        }
+    }
+    res["statements"] = statements;
+    JSonData slow(Json::arrayValue);
+    for(const auto& s : slowQueries()) {
+        JSonData item{};
+        item["fingerprint"] = s.fingerprint;
+        item["parameters"]  = s.parameters;
+        item["us"]          = Json::UInt64(s.micros);
+        item["rows"]        = Json::UInt64(s.rows);
+        item["time"]        = Json::Int64(s.time);
+        slow.append(item);
+    }
+    res["slow"] = slow;
+    return res;
+}
+
+TEGRA_NAMESPACE_END
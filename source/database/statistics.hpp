@@ -0,0 +1,191 @@
+/*!
+ * @file        statistics.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Per-statement latency histograms and slow-query log.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_STATISTICS_HPP
+#define TEGRA_DATABASE_STATISTICS_HPP
+
+//! Tegra's Common.
+#ifdef __has_include
+# if __has_include(<common>)
+#   include <common>
+#else
+#   error "Tegra's common was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+/*!
+ * @brief The LatencyHistogram class is a lock-free log-linear histogram of microsecond values.
+ * Every power of two is split into 16 linear sub-buckets, so a recorded value is reported within 6.25% of its real value.
+ */
+class __tegra_export LatencyHistogram final
+{
+public:
+    __tegra_inline_static_constexpr u32 SubBuckets  = 16;
+    __tegra_inline_static_constexpr u32 Buckets     = 38 * SubBuckets;
+
+    /*!
+     * @brief record function adds a value.
+     * @param micros is the value in microseconds.
+     */
+    void record(u64 micros) __tegra_noexcept;
+
+    /*!
+     * @brief percentile function returns the value below which the given share of values falls.
+     * @param q is the share between 0 and 1.
+     * @returns value in microseconds.
+     */
+    __tegra_no_discard u64 percentile(double q) const __tegra_noexcept;
+
+    /*!
+     * @brief count function returns the number of recorded values.
+     */
+    __tegra_no_discard u64 count() const __tegra_noexcept;
+
+    /*!
+     * @brief max function returns the largest recorded value.
+     */
+    __tegra_no_discard u64 max() const __tegra_noexcept;
+
+    /*!
+     * @brief bucket function returns the number of values recorded in a bucket; its values are at most upperBound(index).
+     */
+    __tegra_no_discard u64 bucket(u32 index) const __tegra_noexcept;
+
+    __tegra_no_discard static u32 indexOf(u64 micros) __tegra_noexcept;
+    __tegra_no_discard static u64 upperBound(u32 index) __tegra_noexcept;
+
+private:
+    std::array<std::atomic<u64>, Buckets>   m_buckets   {};
+    std::atomic<u64>                        m_count     {};
+    std::atomic<u64>                        m_max       {};
+};
+
+/*!
+ * @brief The StatementStats struct holds the counters of one statement fingerprint.
+ */
+struct StatementStats final
+{
+    std::string         fingerprint {};     ///< Normalized statement.
+    std::atomic<u64>    calls       {};     ///< Number of executions.
+    std::atomic<u64>    errors      {};     ///< Number of failed executions.
+    std::atomic<u64>    rows        {};     ///< Number of returned or affected rows.
+    std::atomic<u64>    totalMicros {};     ///< Sum of latencies.
+    LatencyHistogram    latency     {};     ///< Latency distribution.
+};
+
+/*!
+ * @brief The SlowQuery struct is one entry of the slow-query log.
+ */
+struct SlowQuery final
+{
+    std::string     fingerprint {};     ///< Normalized statement.
+    std::string     parameters  {};     ///< Types and sizes of the bound parameters (never their values).
+    u64             micros      {};     ///< Latency.
+    u64             rows        {};     ///< Number of rows.
+    std::time_t     time        {};     ///< Wall clock time of the execution.
+};
+
+/*!
+ * @brief The QueryStatistics class aggregates every statement executed through the database layer by its fingerprint.
+ */
+class __tegra_export QueryStatistics final
+{
+public:
+    /*!
+     * @brief normalize function replaces literals, placeholders and value lists with ? and collapses whitespace.
+     * @param sql is the statement.
+     * @returns fingerprint of the statement.
+     */
+    __tegra_no_discard static std::string normalize(std::string_view sql);
+
+    /*!
+     * @brief record function adds an execution.
+     * @param sql is the statement as executed.
+     * @param micros is the latency.
+     * @param rows is the number of returned or affected rows.
+     * @param failed marks an execution that threw.
+     * @param parameters is the parameter shape, only needed for slow statements.
+     */
+    static void record(const std::string& sql, u64 micros, u64 rows, bool failed, const std::string& parameters = __tegra_null_str);
+
+    /*!
+     * @brief isSlow checks if a latency is above the slow-query threshold.
+     */
+    __tegra_no_discard static bool isSlow(u64 micros) __tegra_noexcept;
+
+    /*!
+     * @brief parameterShape function describes bound parameters without their values.
+     * @returns e.g. "text(5), int, null".
+     */
+    template<typename... Args>
+    __tegra_no_discard static std::string parameterShape(const Args&... args)
+    {
+        std::string res{};
+        (appendShape(res, args), ...);
+        return res;
+    }
+
+    /*!
+     * @brief snapshot function returns all statements with their percentiles and the slow-query log.
+     */
+    __tegra_no_discard static JSonData snapshot();
+
+    /*!
+     * @brief forEach function calls the visitor with every statement, under the read lock of the statistics.
+     */
+    static void forEach(const std::function<void(const std::string& fingerprint, const StatementStats& stats)>& visitor);
+
+    /*!
+     * @brief slowQueries function returns the sampled slow-query log, newest last.
+     */
+    __tegra_no_discard static std::vector<SlowQuery> slowQueries();
+
+    __tegra_inline_static std::atomic<bool>   enabled         { true };   ///< Collection switch.
+    __tegra_inline_static std::atomic<u32>    slowThreshold   { 250 };    ///< Slow-query threshold in milliseconds.
+    __tegra_inline_static std::atomic<double> sampleRate      { 1.0 };    ///< Share of slow statements that are logged.
+    __tegra_inline_static std::atomic<u32>    slowLogSize     { 128 };    ///< Entries kept in the slow-query log.
+
+private:
+    template<typename T>
+    static void appendShape(std::string& shape, const T& value)
+    {
+        using Type = std::decay_t<T>;
+        if(!shape.empty()) shape += ", ";
+        if constexpr (std::is_same_v<Type, std::nullptr_t>) {
+            shape += "null";
+        } else if constexpr (std::is_same_v<Type, bool>) {
+            shape += "bool";
+        } else if constexpr (std::is_integral_v<Type>) {
+            shape += "int";
+        } else if constexpr (std::is_floating_point_v<Type>) {
+            shape += "float";
+        } else if constexpr (std::is_convertible_v<const Type&, std::string_view>) {
+            shape += "text(" + TO_TEGRA_STRING(std::string_view(value).size()) + ")";
+        } else {
+            shape += "other";
+        }
+    }
+
+    __tegra_no_discard static StatementStats& statsOf(const std::string& sql);
+
+    __tegra_inline_static std::shared_mutex                                                 m_mutex         {};
+    __tegra_inline_static std::unordered_map<std::string, Scope<StatementStats>>            m_statements    {};
+    __tegra_inline_static std::unordered_map<std::string, StatementStats*>                  m_raw           {};
+    __tegra_inline_static std::mutex                                                        m_slowMutex     {};
+    __tegra_inline_static std::deque<SlowQuery>                                             m_slow          {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_STATISTICS_HPP
@@ -0,0 +1,237 @@
+//! Tegra's Database Tenant.
+#ifdef __has_include
+# if __has_include("tenant.hpp")
+#   include "tenant.hpp"
+#else
+#   error "Tegra's database tenant was not found!"
+# endif
+#endif
+
+//! Tegra's Database.
+#ifdef __has_include
+# if __has_include(<database>)
+#   include <database>
+#else
+#   error "Tegra's database was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+s64 steadySeconds() __tegra_noexcept
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string hostName(std::string_view host)
+{
+    //! [::1]:8080 keeps its brackets, example.com:8080 loses the port.
+    if(!host.empty() && host.front() != '[') {
+        host = host.substr(0, host.find(':'));
+    }
+    std::string res(host);
+    std::transform(res.begin(), res.end(), res.begin(), [](unsigned char c) { return std::tolower(c); });
+    return res;
+}
+
+std::string quoted(const std::string& value)
+{
+    //! Values of a PostgreSQL connection string are quoted, with quotes and backslashes inside escaped, so a space or quote cannot add a key.
+    std::string res { "'" };
+    for(const char c : value) {
+        if(c == '\'' || c == '\\') res.push_back('\\');
+        res.push_back(c);
+    }
+    res.push_back('\'');
+    return res;
+}
+
+bool isPlain(const std::string& value) __tegra_noexcept
+{
+    //! The MySQL and SQLite parsers of Drogon do not unescape values, so a space or quote can not be written safely.
+    return std::none_of(value.begin(), value.end(), [](const char c) { return std::isspace(static_cast<unsigned char>(c)) || c == '\'' || c == '"' || c == '\\'; });
+}
+
+TEGRA_NAMESPACE_END
+
+void TenantRouter::registerTenant(const Tenant& tenant)
+{
+    if((tenant.rdbms == TEGRA_RDBMS::MySQL || tenant.rdbms == TEGRA_RDBMS::SQLite)
+        && !(isPlain(tenant.host) && isPlain(tenant.database) && isPlain(tenant.username) && isPlain(tenant.password))) {
+        eLogger::Log("Tenant [" + tenant.name + "] has been skipped, its connection values contain spaces or quotes!", eLogger::LoggerType::Critical);
+        return;
+    }
+    Orm::DbClientPtr closed{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& pool = m_pools[tenant.name];
+        if(!pool) {
+            pool = CreateScope<Pool>();
+        }
+        closed = std::move(pool->client);
+        pool->tenant = tenant;
+        std::erase_if(m_hosts, [&tenant](const auto& h) { return h.second == tenant.name; });
+        std::erase_if(m_paths, [&tenant](const auto& p) { return p.second == tenant.name; });
+        for(const auto& h : tenant.hosts) {
+            m_hosts.insert_or_assign(hostName(h), tenant.name);
+        }
+        if(!tenant.path.empty()) {
+            m_paths.emplace_back(tenant.path, tenant.name);
+            std::sort(m_paths.begin(), m_paths.end(), [](const auto& a, const auto& b) { return a.first.size() > b.first.size(); });
+        }
+    }
+    //! Closing a pool joins its threads, so it happens outside the lock.
+    closed.reset();
+}
+
+void TenantRouter::load()
+{
+    const auto tenants = Configuration::GET["tenants"];
+    for(const auto& t : tenants) {
+        if(t.isMember("status") && !BOOLCOMBINER(t, "status")) continue;
+        Tenant tenant;
+        tenant.name         = STRCOMBINER(t, "name");
+        tenant.path         = STRCOMBINER(t, "path");
+        tenant.rdbms        = STRCOMBINER(t, "rdbms");
+        tenant.host         = STRCOMBINER(t, "host");
+        tenant.port         = t["port"].asUInt();
+        tenant.database     = STRCOMBINER(t, "database");
+        tenant.username     = STRCOMBINER(t, "username");
+        tenant.password     = STRCOMBINER(t, "password");
+        tenant.connections  = t.isMember("connections") ? std::max(1u, t["connections"].asUInt()) : 1;
+        for(const auto& h : t["hosts"]) tenant.hosts.push_back(h.asString());
+        if(tenant.name.empty()) {
+            if(DeveloperMode::IsEnable)
+                eLogger::Log("A tenant without name has been skipped!", eLogger::LoggerType::Warning);
+            continue;
+        }
+        registerTenant(tenant);
+    }
+}
+
+std::optional<std::string> TenantRouter::resolve(std::string_view host, std::string_view path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(!m_hosts.empty()) {
+        auto it = m_hosts.find(hostName(host));
+        if(it != m_hosts.end()) return it->second;
+    }
+    for(const auto& [prefix, name] : m_paths) {
+        //! /shop matches /shop and /shop/cart, but not /shopping.
+        if(path.starts_with(prefix) && (path.size() == prefix.size() || path[prefix.size()] == '/' || prefix.ends_with('/'))) {
+            return name;
+        }
+    }
+    return std::nullopt;
+}
+
+Orm::DbClientPtr TenantRouter::open(const Tenant& tenant)
+{
+    const auto connections = std::min(tenant.connections, std::max(1u, maxConnections.load(std::memory_order_relaxed)));
+    if(tenant.rdbms == TEGRA_RDBMS::SQLite) {
+        return Orm::DbClient::newSqlite3Client("filename=" + tenant.database, connections);
+    }
+    //! Only libpq unescapes quoted values; values of the other drivers were checked by registerTenant.
+    const auto value = [&tenant](const std::string& v) { return tenant.rdbms == TEGRA_RDBMS::MySQL ? v : quoted(v); };
+    const auto info = "host=" + value(tenant.host) + " port=" + TO_TEGRA_STRING(tenant.port) + " dbname=" + value(tenant.database)
+                      + " user=" + value(tenant.username) + (tenant.password.empty() ? __tegra_null_str : " password=" + value(tenant.password));
+    if(tenant.rdbms == TEGRA_RDBMS::MySQL) {
+        return Orm::DbClient::newMysqlClient(info, connections);
+    }
+    return Orm::DbClient::newPgClient(info, connections);
+}
+
+void TenantRouter::evict(std::vector<Orm::DbClientPtr>& closed, s64 now)
+{
+    const auto timeout = static_cast<s64>(idleTimeout.load(std::memory_order_relaxed));
+    std::size_t open{};
+    for(auto& [name, pool] : m_pools) {
+        if(!pool->client) continue;
+        if(now - pool->lastUsed.load(std::memory_order_relaxed) >= timeout) {
+            closed.push_back(std::move(pool->client));
+        } else {
+            ++open;
+        }
+    }
+    //! Above the bound, the least recently used pools go first.
+    while(open >= std::max(1u, maxPools.load(std::memory_order_relaxed))) {
+        Pool* oldest{nullptr};
+        for(auto& [name, pool] : m_pools) {
+            if(pool->client && (oldest == nullptr || pool->lastUsed.load(std::memory_order_relaxed) < oldest->lastUsed.load(std::memory_order_relaxed))) {
+                oldest = pool.get();
+            }
+        }
+        if(oldest == nullptr) break;
+        closed.push_back(std::move(oldest->client));
+        --open;
+    }
+}
+
+Orm::DbClientPtr TenantRouter::client(const std::string& tenant)
+{
+    const auto now = steadySeconds();
+    std::vector<Orm::DbClientPtr> closed{};
+    Orm::DbClientPtr res{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_pools.find(tenant);
+        if(it == m_pools.end()) {
+            return nullptr;
+        }
+        auto& pool = *it->second;
+        pool.lastUsed.store(now, std::memory_order_relaxed);
+        if(!pool.client) {
+            //! Room is made before opening, so the bound holds.
+            evict(closed, now);
+            pool.client = open(pool.tenant);
+            if(DeveloperMode::IsEnable)
+                eLogger::Log("Database pool of tenant [" + tenant + "] has been opened.", eLogger::LoggerType::Info);
+        }
+        res = pool.client;
+    }
+    //! Idle pools are swept from the statement path itself, at most once a minute.
+    auto last = m_lastSweep.load(std::memory_order_relaxed);
+    if(now - last >= 60 && m_lastSweep.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        evictIdle();
+    }
+    return res;
+}
+
+void TenantRouter::evictIdle()
+{
+    std::vector<Orm::DbClientPtr> closed{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        evict(closed, steadySeconds());
+    }
+    if(!closed.empty() && DeveloperMode::IsEnable)
+        eLogger::Log(TO_TEGRA_STRING(closed.size()) + " idle tenant database pool(s) have been closed.", eLogger::LoggerType::Info);
+}
+
+std::size_t TenantRouter::openPools()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<std::size_t>(std::count_if(m_pools.begin(), m_pools.end(), [](const auto& p) { return p.second->client != nullptr; }));
+}
+
+const std::optional<std::string>& TenantRouter::current() __tegra_noexcept
+{
+    return m_current;
+}
+
+TenantScope::TenantScope(const std::optional<std::string>& tenant) : m_previous(TenantRouter::m_current)
+{
+    TenantRouter::m_current = tenant;
+}
+
+TenantScope::~TenantScope()
+{
+    TenantRouter::m_current = std::move(m_previous);
+}
+
+TEGRA_NAMESPACE_END
@@ -0,0 +1,139 @@
+/*!
+ * @file        tenant.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Tenant resolution and per-tenant database pools.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_DATABASE_TENANT_HPP
+#define TEGRA_DATABASE_TENANT_HPP
+
+//! Tegra's Common.
+#ifdef __has_include
+# if __has_include(<common>)
+#   include <common>
+#else
+#   error "Tegra's common was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Database)
+
+/*!
+ * @brief The Tenant struct describes one site served by the process, from the "tenants" section of the configuration.
+ * @example {"name":"shop", "hosts":["shop.example.com"], "path":"/shop", "rdbms":"postgresql", "host":"127.0.0.1", "port":5432, "database":"shop", ...}
+ */
+struct Tenant final
+{
+    std::string     name        {};     ///< Unique name of the tenant.
+    VectorString    hosts       {};     ///< Host names (without port) that select the tenant.
+    std::string     path        {};     ///< Path prefix that selects the tenant, e.g. /shop.
+    std::string     rdbms       {};     ///< Driver, e.g. postgresql.
+    std::string     host        {};     ///< Database host.
+    u32             port        {};     ///< Database port.
+    std::string     database    {};     ///< Database name, or file for sqlite3.
+    std::string     username    {};     ///< Database user.
+    std::string     password    {};     ///< Database password.
+    u32             connections {1};    ///< Size of the pool, capped by TenantRouter::maxConnections.
+};
+
+/*!
+ * @brief The TenantRouter class maps requests to tenants and keeps one lazily created pool per active tenant.
+ * A pool is opened on the first statement of its tenant and closed after it stays unused for idleTimeout seconds,
+ * or when more than maxPools are open, the least recently used one is closed first.
+ */
+class __tegra_export TenantRouter final
+{
+public:
+    /*!
+     * @brief registerTenant function adds or replaces a tenant; an open pool of a replaced tenant is closed.
+     * A MySQL or SQLite tenant whose connection values contain spaces or quotes is logged and skipped.
+     * @param tenant is the description of the tenant.
+     */
+    static void registerTenant(const Tenant& tenant);
+
+    /*!
+     * @brief load function registers the tenants of the "tenants" section of the system configuration.
+     */
+    static void load();
+
+    /*!
+     * @brief resolve function finds the tenant of a request, by host first and then by the longest path prefix.
+     * @param host is the Host header, with or without port.
+     * @param path is the request path.
+     * @returns name of the tenant or std::nullopt for the default site.
+     */
+    __tegra_no_discard static std::optional<std::string> resolve(std::string_view host, std::string_view path);
+
+    /*!
+     * @brief client function returns the pool of a tenant, creating it on first use.
+     * @param tenant is the name of the tenant.
+     * @returns database client or nullptr for an unknown tenant.
+     */
+    __tegra_no_discard static Orm::DbClientPtr client(const std::string& tenant);
+
+    /*!
+     * @brief evictIdle function closes the pools that have not been used for idleTimeout seconds.
+     */
+    static void evictIdle();
+
+    /*!
+     * @brief openPools function returns the number of open pools.
+     */
+    __tegra_no_discard static std::size_t openPools();
+
+    /*!
+     * @brief current function returns the tenant of the calling thread.
+     */
+    __tegra_no_discard static const std::optional<std::string>& current() __tegra_noexcept;
+
+    __tegra_inline_static std::atomic<u32> maxPools          { 64 };     ///< Upper bound of open pools.
+    __tegra_inline_static std::atomic<u32> maxConnections    { 4 };      ///< Upper bound of connections per pool.
+    __tegra_inline_static std::atomic<u32> idleTimeout       { 300 };    ///< Seconds before an unused pool is closed.
+
+private:
+    friend class TenantScope;
+
+    struct Pool final
+    {
+        Tenant              tenant      {};
+        Orm::DbClientPtr    client      {};
+        std::atomic<s64>    lastUsed    {};
+    };
+
+    __tegra_no_discard static Orm::DbClientPtr open(const Tenant& tenant);
+    static void evict(std::vector<Orm::DbClientPtr>& closed, s64 now);
+
+    __tegra_inline_static std::mutex                                            m_mutex     {};
+    __tegra_inline_static std::unordered_map<std::string, Scope<Pool>>          m_pools     {};     ///< Tenant name to pool.
+    __tegra_inline_static std::unordered_map<std::string, std::string>          m_hosts     {};     ///< Host to tenant name.
+    __tegra_inline_static std::vector<std::pair<std::string, std::string>>      m_paths     {};     ///< Path prefix to tenant name, longest first.
+    __tegra_inline_static std::atomic<s64>                                      m_lastSweep {};
+    __tegra_inline_static thread_local std::optional<std::string>               m_current   {};
+};
+
+/*!
+ * @brief The TenantScope class binds a tenant to the calling thread, so the router sends its statements to the pool of the tenant.
+ * The binding does not follow work to other threads; code that continues on another thread captures current() and binds it there.
+ * @example TenantScope scope(TenantRouter::resolve(req->getHeader("host"), req->getPath()));
+ */
+class __tegra_export TenantScope final
+{
+public:
+    explicit TenantScope(const std::optional<std::string>& tenant);
+    ~TenantScope();
+    TenantScope(const TenantScope& rhsTenantScope) = delete;
+    TenantScope& operator=(const TenantScope& rhsTenantScope) = delete;
+
+private:
+    std::optional<std::string> m_previous {};
+};
+
+TEGRA_NAMESPACE_END
+
+#endif  // TEGRA_DATABASE_TENANT_HPP
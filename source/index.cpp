@@ -52,6 +52,24 @@
 # endif
 #endif
 
+//! Tegra's Timing.
+#ifdef __has_include
+# if __has_include(<timing>)
+#   include <timing>
+#else
+#   error "Tegra's timing was not found!"
+# endif
+#endif
+
+//! Tegra's Tracing.
+#ifdef __has_include
+# if __has_include(<tracing>)
+#   include <tracing>
+#else
+#   error "Tegra's tracing was not found!"
+# endif
+#endif
+
 //!Tegra
 TEGRA_USING_NAMESPACE Tegra;
 TEGRA_USING_NAMESPACE Tegra::System;
@@ -63,13 +81,29 @@ TEGRA_NAMESPACE_BEGIN(Tegra::Default)
 
 void DefIndex::index(const HttpRequestPtr& req, std::function<void(const HttpResponsePtr &)>&& callback) __tegra_const
 {
+    //! Continues the trace of the proxy, if it sent one.
+    Span span("DefIndex::index", req->getHeader("traceparent"));
+    if(span.isRecording()) {
+        span.setAttribute("http.request.method", req->methodString());
+        span.setAttribute("url.path", req->getPath());
+    }
+
+    //! Statements of this request go to the pool of its tenant, if it has one.
+    TenantScope tenant(TenantRouter::resolve(req->getHeader("host"), req->getPath()));
+
+    //! Where the milliseconds of this page go; see the Server-Timing header.
+    RequestTimer timer;
+
     auto engine = Engine();
 
     Scope<ApplicationData> appDataPtr(new ApplicationData());
 
     auto config = Configuration(ConfigType::File);
 
-    config.init(SectionType::SystemCore);
+    {
+        PhaseTimer phase(Phase::Config);
+        config.init(SectionType::SystemCore);
+    }
 
     {
         appDataPtr->path                    =   req->getPath();                     // Path
@@ -93,14 +127,22 @@ void DefIndex::index(const HttpRequestPtr& req, std::function<void(const HttpRes
         }
     }
 
+    std::optional<PhaseTimer> phase(std::in_place, Phase::Template);
+
     Scope<Template> theme(new Template(UserType::User, *appDataPtr)); // Set user type for remplate.
 
+    phase.emplace(Phase::Language);
+
     Scope<Multilangual::Language> languagePtr(new Multilangual::Language(appDataPtr->path.value()));
 
+    phase.emplace(Phase::Template);
+
     Scope<LoadListTemplate>templateList(new LoadListTemplate(languagePtr->getLanguage(), appDataPtr->path.value()));
 
     auto currentPath = appDataPtr->path.value();
 
+    phase.emplace(Phase::Language);
+
     engine.langsByPath(__tegra_null_str);
 
     /* Check the page path for find by language. */
@@ -109,10 +151,15 @@ void DefIndex::index(const HttpRequestPtr& req, std::function<void(const HttpRes
         engine.setIsMultilanguage(true);
     }
 
+    phase.emplace(Phase::Template);
+
     theme->staticMeta->setDefault(languagePtr->getLanguage()); //Getting default meta data for home page!
 
     theme->viewData.insert("meta", theme->staticMeta->metaData()); //!Metadata
 
+    phase.emplace(Phase::Translation);
+    std::optional<Span> translation(std::in_place, "Translator::translate");
+
     /* Custom Translate Section */
     theme->viewData.insert("title"          , templateList->title().value_or(TEGRA_TRANSLATOR("global", "name")));
     theme->viewData.insert("description"    , templateList->description().value_or(TEGRA_TRANSLATOR("global", "slogan_desc")));
@@ -136,15 +183,37 @@ void DefIndex::index(const HttpRequestPtr& req, std::function<void(const HttpRes
         }
     }
 
+    translation.reset();
+    phase.reset();
+
+    //! Renders the view and sends it with the metrics of the page.
+    const auto respond = [&](const std::string& viewId) {
+        const auto pageInitTime = timer.elapsed();
+        HttpResponsePtr resp{};
+        {
+            PhaseTimer render(Phase::Render);
+            Span renderSpan("View::render");
+            renderSpan.setAttribute("view", viewId);
+            resp = HttpResponse::newHttpViewResponse(viewId, theme->viewData);
+        }
+        span.setAttribute("http.response.body.size", static_cast<s64>(resp->body().size()));
+        timer.setSize(resp->body().size());
+        timer.finish();
+        engine.setPageMetrics(static_cast<std::time_t>(timer.elapsed()), static_cast<std::time_t>(pageInitTime), static_cast<u32>(timer.size()));
+        if(RequestTimer::serverTimingHeader.load(std::memory_order_relaxed)) {
+            resp->addHeader("Server-Timing", timer.serverTiming());
+        }
+        callback(resp);
+    };
+
     if (engine.isMultilanguage() && IsConnected) {
         //Multi-Language logic code here...
-        auto resp = HttpResponse::newHttpViewResponse(appDataPtr->templateViewId.value(), theme->viewData);
-        callback(resp);
+        respond(appDataPtr->templateViewId.value());
     } else if(currentPath == "/" && IsConnected) {
         //Single-Language logic code here...
-        auto resp = HttpResponse::newHttpViewResponse(appDataPtr->templateViewId.value(), theme->viewData);
-        callback(resp);
+        respond(appDataPtr->templateViewId.value());
     } else {
+        phase.emplace(Phase::Translation);
         //Page not found!
         if(!isset(IsConnected)) {
             theme->viewData.insert("title",        templateList->title().value_or(TEGRA_TRANSLATOR("exceptions", "empty")));
@@ -167,8 +236,8 @@ void DefIndex::index(const HttpRequestPtr& req, std::function<void(const HttpRes
             theme->viewData.insert("goback",       TEGRA_TRANSLATOR("dialog", "goback"));
         }
 
-        auto resp = HttpResponse::newHttpViewResponse(appDataPtr->templateViewErrorId.value(), theme->viewData);
-        callback(resp);
+        phase.reset();
+        respond(appDataPtr->templateViewErrorId.value());
     }
 
 }
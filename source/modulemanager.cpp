@@ -160,6 +160,8 @@ void ModuleManager::unload(AbstractModule *&module)
             {
                 Log("ERROR: Unable to find symbol [DestroyModule] in library " + FROM_TEGRA_STRING(module->getName().value().c_str()), LoggerType::Critical);
             }
+            //! Queued records point at the texts of the library, so they are written before it is unmapped.
+            Logger::flush();
             // Unload the library and remove the library from the map.
 #if defined(PLATFORM_WINDOWS)
             FreeLibrary(hModule);
@@ -0,0 +1,39 @@
+//! Tegra's Monitoring.
+#ifdef __has_include
+# if __has_include("monitoring.hpp")
+#   include "monitoring.hpp"
+#else
+#   error "Tegra's monitoring was not found!"
+# endif
+#endif
+
+//! Tegra's Metrics.
+#ifdef __has_include
+# if __has_include(<metrics>)
+#   include <metrics>
+#else
+#   error "Tegra's metrics was not found!"
+# endif
+#endif
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::System;
+TEGRA_USING_NAMESPACE Framework;
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Default)
+
+void DefMonitoring::metrics(const HttpRequestPtr& req, std::function<void(const HttpResponsePtr &)>&& callback) __tegra_const
+{
+    auto resp = HttpResponse::newHttpResponse();
+    if(!Metrics::enabled.load(std::memory_order_relaxed)) {
+        resp->setStatusCode(k404NotFound);
+    } else if(!Metrics::isAllowed(req->peerAddr().toIp())) {
+        resp->setStatusCode(k403Forbidden);
+    } else {
+        resp->setContentTypeString(FROM_TEGRA_STRING(Metrics::ContentType));
+        resp->setBody(Metrics::scrape());
+    }
+    callback(resp);
+}
+
+TEGRA_NAMESPACE_END
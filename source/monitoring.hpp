@@ -0,0 +1,46 @@
+/*!
+ * @file        monitoring.hpp
+ * @brief       This file is part of the Tegra System.
+ * @details     Metrics endpoint.
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+#ifndef TEGRA_MONITORING_HPP
+#define TEGRA_MONITORING_HPP
+
+//! Tegra's Common.
+#ifdef __has_include
+# if __has_include(<common>)
+#   include <common>
+#else
+#   error "Tegra's common was not found!"
+# endif
+#endif
+
+TEGRA_NAMESPACE_BEGIN(Tegra::Default)
+
+class DefMonitoring : public Framework::HttpController<DefMonitoring>
+{
+public:
+    METHOD_LIST_BEGIN
+    {
+        ADD_METHOD_TO(DefMonitoring::metrics, "/metrics", {Framework::Get});
+    }
+    METHOD_LIST_END
+
+    /*!
+    * \brief metrics returns the registry in the Prometheus text format.
+    * \param req for Http request.
+    * \param callback for Http response.
+    */
+    void metrics(const Framework::HttpRequestPtr& req, std::function<void(const Framework::HttpResponsePtr&)>&& callback) __tegra_const;
+};
+
+TEGRA_NAMESPACE_END
+
+#endif // TEGRA_MONITORING_HPP
@@ -16,6 +16,15 @@
 # endif
 #endif
 
+//! Tegra's Metrics.
+#ifdef __has_include
+# if __has_include(<metrics>)
+#   include <metrics>
+#else
+#   error "Tegra's metrics was not found!"
+# endif
+#endif
+
 TEGRA_USING_NAMESPACE Tegra;
 TEGRA_USING_NAMESPACE Tegra::System;
 TEGRA_USING_NAMESPACE Tegra::Abstracts;
@@ -58,6 +67,7 @@ PluginManager& PluginManager::instance()
 __tegra_no_discard AbstractPlugin* PluginManager::load(const std::string& name)
 {
     AbstractPlugin* plugin = nullptr;
+    const auto started = std::chrono::steady_clock::now();
     PluginMap::iterator iter = m_implementation->m_plugins.find(name);
     try {
         if (iter == m_implementation->m_plugins.end())
@@ -96,6 +106,8 @@ __tegra_no_discard AbstractPlugin* PluginManager::load(const std::string& name)
                         // Add the plugin and library18 to the maps.
                         m_implementation->m_plugins.insert(PluginMap::value_type(name, plugin));
                         m_implementation->m_libs.insert(LibraryMap::value_type(name, hModule));
+                        Metrics::gauge("tegra_plugin_load_duration_seconds", "Time taken to load and create a plugin.", { { "plugin", name } })
+                            .set(std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count());
                     }
                     else
                     {
@@ -165,6 +177,8 @@ void PluginManager::unload(AbstractPlugin *&plugin)
             {
                 Log("ERROR: Unable to find symbol [DestroyPlugin] in library " + FROM_TEGRA_STRING(plugin->getName().value().c_str()), LoggerType::Critical);
             }
+            //! Queued records point at the texts of the library, so they are written before it is unmapped.
+            Logger::flush();
             // Unload the library and remove the library from the map.
 #if defined(PLATFORM_WINDOWS)
             FreeLibrary(hModule);
@@ -403,6 +403,7 @@ LanguageTemplate Translator::translate(const std::string& lang, const std::strin
             return wordMap.at(defaultLanguage()).at(sheet).at(key);
             m_hasError = false;
         } catch (const std::out_of_range& e) {
+            misses.fetch_add(1, std::memory_order_relaxed);
             Log("Error Message: [" + key + "]\t" + std::string(e.what()), LoggerType::Warning);
             m_errorMessage = std::string(e.what());
             m_hasError = true;
@@ -414,6 +415,7 @@ LanguageTemplate Translator::translate(const std::string& lang, const std::strin
             return wordMap.at(lang).at(sheet).at(key);
             m_hasError = false;
         } catch (const std::out_of_range& e) {
+            misses.fetch_add(1, std::memory_order_relaxed);
             Log("Error Message: [" + key + "]\t" + std::string(e.what()), LoggerType::Warning);
             m_errorMessage = std::string(e.what());
             m_hasError = true;
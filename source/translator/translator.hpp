@@ -277,6 +277,11 @@ public:
      */
     __tegra_no_discard DictonaryType data(const std::string& sheet) __tegra_noexcept;
 
+    /*!
+     * \brief misses is the number of translate calls that found no word for their key.
+     */
+    __tegra_inline_static std::atomic<u64> misses {};
+
 protected:
     JSonPointer       jsonParser{};   // JSon Parser
     LanguageMap       wordMap{};    // Language map.
@@ -0,0 +1,243 @@
+/*!
+ * @file        main.cpp
+ * @brief       This file is part of the Tegra System.
+ * @details     tegra-logcat decodes the binary log files of the DataMining mode to text or JSON lines.
+ *              Usage: tegra-logcat [--json] file.tlog...
+ * @author      <a href='https://www.kambizasadzadeh.com'>Kambiz Asadzadeh</a>
+ * @package     The Genyleap
+ * @since       19 Oct 2026
+ * @copyright   Copyright (c) 2026 The Genyleap. All rights reserved.
+ * @license     https://github.com/genyleap/tegra/blob/main/LICENSE.md
+ *
+ */
+
+//! Tegra's Log Format.
+#ifdef __has_include
+# if __has_include("core/logformat.hpp")
+#   include "core/logformat.hpp"
+#else
+#   error "Tegra's log format was not found!"
+# endif
+#endif
+
+#include <fmt/args.h>
+
+TEGRA_USING_NAMESPACE Tegra;
+TEGRA_USING_NAMESPACE Tegra::eLogger;
+
+TEGRA_ANONYMOUS_NAMESPACE_BEGIN
+
+struct Entry final
+{
+    u64                 nanoseconds {};
+    u64                 thread      {};
+    u32                 counter     {};
+    u32                 line        {};
+    std::string_view    function    {};
+    std::string_view    file        {};
+    std::string         message     {};
+    int                 type        {};
+};
+
+std::string lookup(const std::unordered_map<u32, std::string>& strings, const u32 id)
+{
+    auto it = strings.find(id);
+    return it == strings.end() ? "?" : it->second;
+}
+
+/*!
+ * @brief formatArguments function formats the encoded arguments with their format, or lists them when the format fails.
+ */
+std::string formatArguments(std::string_view format, std::string_view arguments)
+{
+    fmt::dynamic_format_arg_store<fmt::format_context> store{};
+    std::vector<std::string> raw{};
+    while(!arguments.empty()) {
+        Binary::Argument tag{};
+        if(!Binary::get(arguments, tag)) break;
+        switch (tag) {
+        case Binary::Argument::Signed: {
+            s64 value{};
+            if(!Binary::get(arguments, value)) return "<truncated>";
+            store.push_back(value);
+            raw.push_back(TO_TEGRA_STRING(value));
+            break;
+        }
+        case Binary::Argument::Unsigned: {
+            u64 value{};
+            if(!Binary::get(arguments, value)) return "<truncated>";
+            store.push_back(value);
+            raw.push_back(TO_TEGRA_STRING(value));
+            break;
+        }
+        case Binary::Argument::Float: {
+            double value{};
+            if(!Binary::get(arguments, value)) return "<truncated>";
+            store.push_back(value);
+            raw.push_back(TO_TEGRA_STRING(value));
+            break;
+        }
+        case Binary::Argument::Boolean: {
+            u8 value{};
+            if(!Binary::get(arguments, value)) return "<truncated>";
+            store.push_back(value != 0);
+            raw.push_back(value != 0 ? "true" : "false");
+            break;
+        }
+        case Binary::Argument::String: {
+            std::string_view value{};
+            if(!Binary::get(arguments, value)) return "<truncated>";
+            store.push_back(std::string(value));
+            raw.emplace_back(value);
+            break;
+        }
+        default:
+            return "<unknown argument>";
+        }
+    }
+    try {
+        return fmt::vformat(format, store);
+    } catch (const fmt::format_error&) {
+        std::string res(format);
+        for(const auto& value : raw) res += " | " + value;
+        return res;
+    }
+}
+
+std::string escape(std::string_view text)
+{
+    std::string res{};
+    res.reserve(text.size());
+    for(const char c : text) {
+        switch (c) {
+        case '"':  res += "\\\""; break;
+        case '\\': res += "\\\\"; break;
+        case '\n': res += "\\n";  break;
+        case '\r': res += "\\r";  break;
+        case '\t': res += "\\t";  break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20) {
+                res += fmt::format("\\u{:04x}", static_cast<int>(c));
+            } else {
+                res.push_back(c);
+            }
+        }
+    }
+    return res;
+}
+
+std::string timeOf(const u64 nanoseconds)
+{
+    const auto seconds = static_cast<time_t>(nanoseconds / 1000000000);
+    std::tm local{};
+#ifdef PLATFORM_WINDOWS
+    localtime_s(&local, &seconds);
+#else
+    localtime_r(&seconds, &local);
+#endif
+    std::array<char, 32> buffer{};
+    const auto size = std::strftime(buffer.data(), buffer.size(), "%Y-%m-%dT%H:%M:%S", &local);
+    return fmt::format("{}.{:09}", std::string_view(buffer.data(), size), nanoseconds % 1000000000);
+}
+
+void print(const Entry& entry, const bool json)
+{
+    if(json) {
+        std::cout << fmt::format(R"({{"time":"{}","ns":{},"type":"{}","thread":{},"id":{},"line":{},"function":"{}","file":"{}","message":"{}"}})",
+                                 timeOf(entry.nanoseconds), entry.nanoseconds, Binary::typeName(entry.type), entry.thread, entry.counter,
+                                 entry.line, escape(entry.function), escape(entry.file), escape(entry.message)) << __tegra_newline;
+    } else {
+        std::cout << fmt::format("{} [{}] [{}] {}:{} {}: {}", timeOf(entry.nanoseconds), Binary::typeName(entry.type), entry.thread,
+                                 entry.file, entry.line, entry.function, entry.message) << __tegra_newline;
+    }
+}
+
+/*!
+ * @brief decode function prints every record of a file; false when the file is not a log file.
+ */
+bool decode(const std::filesystem::path& path, const bool json)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if(!stream.is_open()) {
+        std::cerr << "tegra-logcat: can not open [" << path.string() << "]" << __tegra_newline;
+        return false;
+    }
+    const std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    std::string_view in(content);
+    if(!in.starts_with(Binary::MAGIC)) {
+        std::cerr << "tegra-logcat: [" << path.string() << "] is not a Tegra log file" << __tegra_newline;
+        return false;
+    }
+    in.remove_prefix(Binary::MAGIC.size());
+    std::unordered_map<u32, std::string> strings{};
+    bool complete = true;
+    while(!in.empty()) {
+        Binary::Frame frame{};
+        Binary::get(in, frame);
+        if(frame == Binary::Frame::String) {
+            u32 id{};
+            std::string_view text{};
+            if(!Binary::get(in, id) || !Binary::get(in, text)) {
+                complete = false;
+                break;
+            }
+            strings[id] = std::string(text);
+            continue;
+        }
+        if(frame != Binary::Frame::Record) {
+            std::cerr << "tegra-logcat: [" << path.string() << "] has an unknown frame" << __tegra_newline;
+            return false;
+        }
+        Entry entry{};
+        u32 function{}, file{}, format{};
+        u8 type{};
+        std::string_view payload{};
+        if(!Binary::get(in, entry.nanoseconds) || !Binary::get(in, entry.thread) || !Binary::get(in, entry.counter)
+            || !Binary::get(in, entry.line) || !Binary::get(in, function) || !Binary::get(in, file) || !Binary::get(in, format)
+            || !Binary::get(in, type) || !Binary::get(in, payload)) {
+            complete = false;
+            break;
+        }
+        const auto functionName = lookup(strings, function);
+        const auto fileName     = lookup(strings, file);
+        entry.function  = functionName;
+        entry.file      = fileName;
+        entry.type      = type;
+        entry.message   = format == __tegra_zero ? std::string(payload) : formatArguments(lookup(strings, format), payload);
+        print(entry, json);
+    }
+    if(!complete) {
+        //! The last record of a file that is still written may be incomplete.
+        std::cerr << "tegra-logcat: [" << path.string() << "] ends with an incomplete record" << __tegra_newline;
+    }
+    return true;
+}
+
+TEGRA_NAMESPACE_END
+
+int main(int argc, char* argv[])
+{
+    bool json = false;
+    std::vector<std::filesystem::path> files{};
+    for(int i = 1; i < argc; ++i) {
+        const std::string_view argument(argv[i]);
+        if(argument == "--json") {
+            json = true;
+        } else if(argument == "--help" || argument == "-h") {
+            std::cout << "Usage: tegra-logcat [--json] file.tlog..." << __tegra_newline;
+            return EXIT_SUCCESS;
+        } else {
+            files.emplace_back(argument);
+        }
+    }
+    if(files.empty()) {
+        std::cerr << "Usage: tegra-logcat [--json] file.tlog..." << __tegra_newline;
+        return EXIT_FAILURE;
+    }
+    bool succeeded = true;
+    for(const auto& file : files) {
+        succeeded = decode(file, json) && succeeded;
+    }
+    std::cout.flush();
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}